@@ -4,6 +4,7 @@
 
 #include <cmath>
 #include <complex>
+#include <cstdlib>
 #include <limits>
 
 typedef double Real;
@@ -14,6 +15,46 @@ typedef size_t SizeType;
 #define NUM_MIN std::numeric_limits<Real>::min()
 #define NUM_MAX std::numeric_limits<Real>::max()
 
+// Runtime SIMD dispatch for hot kernels. On x86-64 with GCC or Clang, a
+// function annotated with this macro is compiled once per listed instruction
+// set and the best version is chosen at load time based on what the CPU
+// supports, so a single binary gets AVX-512 where available without giving up
+// portability. Elsewhere the macro expands to nothing and the default code
+// generation applies
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ELEMENTS_SIMD_DISPATCH \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define ELEMENTS_SIMD_DISPATCH
+#endif
+
+// No-alias and alignment annotations for hot-kernel pointer parameters. A
+// parameter marked ELEMENTS_RESTRICT promises the compiler that the data it
+// writes is not accessed through any other pointer in the same scope, which
+// is the guarantee the loop vectorizer needs to drop its runtime aliasing
+// checks; callers must not pass an output array that overlaps an input.
+// ELEMENTS_ASSUME_ALIGNED asserts that a pointer carries the work-array
+// alignment (it must only be applied to allocations made through the aligned
+// allocator below)
+#if defined(__GNUC__) || defined(__clang__)
+#define ELEMENTS_RESTRICT __restrict__
+#define ELEMENTS_ASSUME_ALIGNED(p) \
+    (static_cast<decltype(p)>(__builtin_assume_aligned((p), 64)))
+#else
+#define ELEMENTS_RESTRICT
+#define ELEMENTS_ASSUME_ALIGNED(p) (p)
+#endif
+
+// Marks a small branch-free kernel as hot so the compiler optimizes it more
+// aggressively, places it with the other hot code, and inlines everything it
+// calls into one straight-line body (flatten). Reserved for kernels that
+// dominate profiles, such as the Hex32 shape-function evaluation
+#if defined(__GNUC__) || defined(__clang__)
+#define ELEMENTS_HOT __attribute__((hot, flatten))
+#else
+#define ELEMENTS_HOT
+#endif
+
 namespace common {
   // Definitions used to ensure compatibility when switching from real number
   // type to complex number type to test derivative implementations via the
@@ -34,6 +75,32 @@ namespace common {
     return common::abs(a - b) < 2.0*NUM_EPS;
   };
 
+  // Accumulation type associated with a storage type. Reduced-precision
+  // storage types map to double precision here, so kernels that declare
+  // their accumulators through this trait keep full-precision partial sums
+  // while loading and storing narrow data
+  template <typename NumType>
+  struct accum_type { typedef NumType type; };
+
+  template <>
+  struct accum_type<float> { typedef double type; };
+
+  // Aligned allocation of work arrays. Allocations are aligned to and padded
+  // out to 64 bytes (a cache line, and the widest SIMD register width), so
+  // vectorized loads and stores on the arrays need not straddle cache lines
+  const SizeType work_array_alignment = 64;
+
+  template <typename NumType>
+  inline NumType *allocate_aligned(SizeType n) {
+    SizeType bytes = n*sizeof(NumType);
+    bytes += (work_array_alignment - bytes%work_array_alignment)
+        %work_array_alignment;
+    return static_cast<NumType *>(std::aligned_alloc(work_array_alignment,
+        bytes));
+  }
+
+  inline void deallocate_aligned(void *p) { std::free(p); }
+
   // Converting between representations of array indices
   void base_10_to_mixed_radix(const SizeType Nb, const SizeType *b, 
       SizeType x, SizeType *y);
@@ -52,11 +52,14 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <iostream>  // std::cout etc.
 #include <cmath>
+#include <vector>
 
 #include "utilities.h"
+#include "common.h"
+#include "lagrange_polynomials.h"
 #include "elements.h"
 
-#define EPSILON 1.0e-12
+static constexpr real_t EPSILON = 1.0e-12;
 
 using namespace utils;
 
@@ -3270,22 +3273,18 @@ as follows
 
 Quad4::Quad4() : Element2D(){
   nsurfaces = 4;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 2;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 1;
-
-  surface_to_dof_lid(1,0) = 3;
-  surface_to_dof_lid(1,1) = 2;
-
-  surface_to_dof_lid(2,0) = 0;
-  surface_to_dof_lid(2,1) = 3;
-
-  surface_to_dof_lid(3,0) = 1;
-  surface_to_dof_lid(3,1) = 2;
+  static constexpr int surf_dofs[4][2] = {
+      {0, 1},
+      {3, 2},
+      {0, 3},
+      {1, 2}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 2);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 2; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -3293,37 +3292,6 @@ Quad4::~Quad4(){
 
 }
 
-real_t Quad4::ref_vert[Quad4::num_verts_*Quad4::num_dim_] = 
-    
-    {// listed as {Xi, Eta}
-    -1.0, -1.0,// 0
-     1.0, -1.0,// 1
-     1.0,  1.0,// 2
-    -1.0,  1.0,// 3
-    };
-
-const int Quad4::vert_to_node[Quad4::num_verts_] = 
-    {
-    0,
-    2,
-    6,
-    8
-    };
-
-
-int Quad4::num_verts()
-{
-    return Quad4::num_verts_;
-}
-int Quad4::num_nodes()
-{
-    return Quad4::num_nodes_;
-}
-int Quad4::num_basis()
-{
-    return Quad4::num_basis_;
-}
-
 
 // calculate a physical position in an element for a given xi,eta
 void Quad4::physical_position(
@@ -3331,26 +3299,24 @@ void Quad4::physical_position(
     const ViewCArray <real_t> &xi_point, 
     const ViewCArray <real_t> &vertices){
 
+    // evaluate the shape functions through the basis kernel (the single
+    // source of truth for the expressions) and fuse the position
+    // accumulation over them; the kernel inlines here, so the stack buffer
+    // never leaves registers
     real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
+    this->basis(basis_a, xi_point(0), xi_point(1));
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
 
-    // calculate the shape functions from each vertex for 0 through num_verts_(xi,eta)
+    #pragma GCC unroll 4
     for( int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1));
+        x0 += vertices(vert_lid, 0)*basis_a[vert_lid];
+        x1 += vertices(vert_lid, 1)*basis_a[vert_lid];
     }// end for
 
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++) x_point(dim) = 0.0;
-    
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        for (int dim = 0; dim < num_dim_; dim++){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        }// end for dim
-    } // end for vert_lid
+    x_point(0) = x0;
+    x_point(1) = x1;
 
 } // end of physical position functionfunction
 
@@ -3360,16 +3326,7 @@ void Quad4::basis(
     ViewCArray <real_t> &basis,
     const ViewCArray <real_t> &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-    
-    // calculate the shape functions from each vertex for 0 through num_verts_(xi,eta)
-    for( int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-
-        basis(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1));
-
-    }// end for
+    this->basis(&basis(0), xi_point(0), xi_point(1));
 
 }// end of quad4 basis functions 
 
@@ -3379,13 +3336,7 @@ void  Quad4::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-    
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
-        partial_xi(vert_lid) = (1.0/4.0)
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1));
-    }
+    this->partial_xi_basis(&partial_xi(0), xi_point(0), xi_point(1));
 
 }// end of partial xi funciton
 
@@ -3395,15 +3346,87 @@ void  Quad4::partial_eta_basis(
     ViewCArray <real_t> &partial_eta, 
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_eta_basis(&partial_eta(0), xi_point(0), xi_point(1));
+
+}// end of partial eta function
+
+
+// calculate the basis at a batch of points (vertex-major output: all
+// evaluations for one vertex are contiguous). With the vertex loop outside,
+// the point loop carries no dependences and every load and store is unit
+// stride, so the compiler vectorizes across points with the reference-vertex
+// signs held in registers
+ELEMENTS_SIMD_DISPATCH
+void Quad4::basis_batch(
+    real_t *ELEMENTS_RESTRICT basis_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const size_t num_points){
 
     for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
-        partial_eta(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1));
+        const real_t xi_vert  = ref_vert[vert_lid*num_dim_ + 0];
+        const real_t eta_vert = ref_vert[vert_lid*num_dim_ + 1];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/4.0)
+                * (1.0 + xi[i]*xi_vert)
+                * (1.0 + eta[i]*eta_vert);
+        }
     }
 
-}// end of partial eta function
+}// end of quad4 batched basis functions
+
+
+// Partial derivative of shape functions with respect to Xi at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Quad4::partial_xi_basis_batch(
+    real_t *ELEMENTS_RESTRICT partial_xi_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const size_t num_points){
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        const real_t xi_vert  = ref_vert[vert_lid*num_dim_ + 0];
+        const real_t eta_vert = ref_vert[vert_lid*num_dim_ + 1];
+        real_t *out = partial_xi_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/4.0)
+                * (xi_vert)
+                * (1.0 + eta[i]*eta_vert);
+        }
+    }
+
+}// end of quad4 batched partial xi function
+
+
+// Partial derivative of shape functions with respect to Eta at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Quad4::partial_eta_basis_batch(
+    real_t *ELEMENTS_RESTRICT partial_eta_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const size_t num_points){
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        const real_t xi_vert  = ref_vert[vert_lid*num_dim_ + 0];
+        const real_t eta_vert = ref_vert[vert_lid*num_dim_ + 1];
+        real_t *out = partial_eta_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/4.0)
+                * (1.0 + xi[i]*xi_vert)
+                * (eta_vert);
+        }
+    }
+
+}// end of quad4 batched partial eta function
 
 int Quad4::vert_node_map(const int vert_lid){
 
@@ -3440,27 +3463,18 @@ int Quad4::vert_node_map(const int vert_lid){
 
 Quad8::Quad8() : Element2D(){
   nsurfaces = 4;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 3;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 4;
-  surface_to_dof_lid(0,2) = 1;
-
-  surface_to_dof_lid(1,0) = 3;
-  surface_to_dof_lid(1,1) = 6;
-  surface_to_dof_lid(1,2) = 2;
-
-  surface_to_dof_lid(2,0) = 0;
-  surface_to_dof_lid(2,1) = 7;
-  surface_to_dof_lid(2,2) = 3;
-
-  surface_to_dof_lid(3,0) = 1;
-  surface_to_dof_lid(3,1) = 5;
-  surface_to_dof_lid(3,2) = 2;
+  static constexpr int surf_dofs[4][3] = {
+      {0, 4, 1},
+      {3, 6, 2},
+      {0, 7, 3},
+      {1, 5, 2}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 3);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 3; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -3468,86 +3482,29 @@ Quad8::~Quad8(){
 
 }
 
-real_t Quad8::ref_vert[Quad8::num_verts_*Quad8::num_dim_] = // listed as {Xi, Eta}
-    {// listed as {Xi, Eta}
-    -1.0, -1.0, // 0  
-     1.0, -1.0, // 1
-     1.0,  1.0, // 2
-    -1.0,  1.0, // 3
-    // midline nodes
-     0.0, -1.0, // 4
-     1.0,  0.0, // 5
-     0.0,  1.0, // 6
-    -1.0,  0.0, // 7
-    };
-
-const int Quad8::vert_to_node[Quad8::num_verts_] = 
-    {
-    0,
-    4,
-    24,
-    20,
-    2,
-    14,
-    23,
-    10
-    };
-
-int Quad8::num_verts()
-{
-    return Quad8::num_verts_;
-}
-int Quad8::num_nodes()
-{
-    return Quad8::num_nodes_;
-}
-int Quad8::num_basis()
-{
-    return Quad8::num_basis_;
-}
-
 // calculate a physical position in an element for a given xi,eta,
 void Quad8::physical_position(
     ViewCArray <real_t> &x_point, 
     const ViewCArray <real_t> &xi_point, 
     const ViewCArray <real_t> &vertices){
 
+    // evaluate the shape functions through the basis kernel (the single
+    // source of truth for the expressions) and fuse the position
+    // accumulation over them
     real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
+    this->basis(basis_a, xi_point(0), xi_point(1));
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
 
-    // calculate the shape functions for node 0,1,2,3(xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        basis(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (xi_point(0)*ref_verts(vert_lid, 0) 
-            +  xi_point(1)*ref_verts(vert_lid, 1) - 1.0);
-    } // end for vert_lid
-
-    // calculate the shape functions for node 4,6(xi,eta)
-    for( int vert_lid = 4; vert_lid <= 6; vert_lid += 2 ){
-        basis(vert_lid) = (1.0/2.0)
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1));
-    } // end for vert_lid
-
-    // calculate the shape functions for node 5,7 (xi,eta)
-    for( int vert_lid = 5; vert_lid <= 7; vert_lid += 2 ){
-        basis(vert_lid) = (1.0/2.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1));
+    #pragma GCC unroll 8
+    for( int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
+        x0 += vertices(vert_lid, 0)*basis_a[vert_lid];
+        x1 += vertices(vert_lid, 1)*basis_a[vert_lid];
     } // end for vert_lid
 
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++) x_point(dim) = 0.0;
-
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        for (int dim = 0; dim < num_dim_; dim++){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        } // end for dim
-    } // end for vert_lid
+    x_point(0) = x0;
+    x_point(1) = x1;
 
 } // end of function
 
@@ -3557,34 +3514,98 @@ void Quad8::basis(
     ViewCArray <real_t> &basis,
     const ViewCArray <real_t> &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-    
-    // calculate the shape functions for node 0,1,2,3(xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        basis(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (xi_point(0)*ref_verts(vert_lid, 0) 
-            +  xi_point(1)*ref_verts(vert_lid, 1) - 1.0);
-    } // end for vert_lid
+    this->basis(&basis(0), xi_point(0), xi_point(1));
 
+}// end of quad8 basis functions
 
-    // calculate the shape functions for node 4,6(xi,eta)
-    for( int vert_lid = 4; vert_lid <= 6; vert_lid += 2 ){
-        basis(vert_lid) = (1.0/2.0)
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1));
-    } // end for vert_lid
 
-    // calculate the shape functions for node 5,7 (xi,eta)
-    for( int vert_lid = 5; vert_lid <= 7; vert_lid += 2 ){
-        basis(vert_lid) = (1.0/2.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1));
+// raw-pointer overload: writes the basis evaluations through a contiguous
+// buffer with plain stores, keeping view bookkeeping out of the loops
+void Quad8::basis(
+    real_t *ELEMENTS_RESTRICT basis,
+    const real_t xi,
+    const real_t eta){
+
+    // the ref_vert entries are all +-1 or 0, so the vertex-dependent factors
+    // collapse to a handful of shared values; compute those once and write
+    // each shape function as a short product of them
+    const real_t xm  = 1.0 - xi;
+    const real_t xp  = 1.0 + xi;
+    const real_t ym  = 1.0 - eta;
+    const real_t yp  = 1.0 + eta;
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t ysq = 1.0 - eta*eta;
+
+    // the shape functions for node 0,1,2,3 (xi,eta)
+    basis[0] = (1.0/4.0) * xm * ym * (-xi - eta - 1.0);
+    basis[1] = (1.0/4.0) * xp * ym * ( xi - eta - 1.0);
+    basis[2] = (1.0/4.0) * xp * yp * ( xi + eta - 1.0);
+    basis[3] = (1.0/4.0) * xm * yp * (-xi + eta - 1.0);
+
+    // the shape functions for node 4,6 (xi,eta)
+    basis[4] = (1.0/2.0) * xsq * ym;
+    basis[6] = (1.0/2.0) * xsq * yp;
+
+    // the shape functions for node 5,7 (xi,eta)
+    basis[5] = (1.0/2.0) * xp * ysq;
+    basis[7] = (1.0/2.0) * xm * ysq;
+
+}// end of quad8 basis functions (raw pointer)
+
+
+// Basis evaluation at a batch of points, written vertex-major so all
+// evaluations for one vertex are contiguous. The point loop runs per vertex
+// group with the reference-vertex signs hoisted, so every load and store is
+// unit stride and the compiler vectorizes across points
+ELEMENTS_SIMD_DISPATCH
+void Quad8::basis_batch(
+    real_t *ELEMENTS_RESTRICT basis_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const size_t num_points){
+
+    // the corner vertices 0,1,2,3
+    for (int vert_lid = 0; vert_lid < 4; vert_lid++){
+        const real_t xi_vert  = ref_vert[vert_lid*num_dim_ + 0];
+        const real_t eta_vert = ref_vert[vert_lid*num_dim_ + 1];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/4.0)
+                * (1.0 + xi[i]*xi_vert)
+                * (1.0 + eta[i]*eta_vert)
+                * (xi[i]*xi_vert + eta[i]*eta_vert - 1.0);
+        }
+    }
 
-    } // end for vert_lid
+    // the midline vertices 4,6
+    for (int vert_lid = 4; vert_lid <= 6; vert_lid += 2){
+        const real_t eta_vert = ref_vert[vert_lid*num_dim_ + 1];
+        real_t *out = basis_out + vert_lid*num_points;
 
-}// end of quad8 basis functions
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/2.0)
+                * (1.0 - xi[i]*xi[i])
+                * (1.0 + eta[i]*eta_vert);
+        }
+    }
+
+    // the midline vertices 5,7
+    for (int vert_lid = 5; vert_lid <= 7; vert_lid += 2){
+        const real_t xi_vert = ref_vert[vert_lid*num_dim_ + 0];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = (1.0/2.0)
+                * (1.0 + xi[i]*xi_vert)
+                * (1.0 - eta[i]*eta[i]);
+        }
+    }
+
+}// end of quad8 batched basis functions
 
 
 // Partial derivative of shape functions with respect to Xi
@@ -3592,34 +3613,38 @@ void Quad8::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_xi_basis(&partial_xi(0), xi_point(0), xi_point(1));
 
-    // calculate the Xi partials for node 0,1,2,3 (xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        partial_xi(vert_lid) = 1.0/4.0
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + ref_verts(vert_lid, 1)*xi_point(1))
-            *((2.0 * ref_verts(vert_lid, 0)*xi_point(0)) 
-            + (ref_verts(vert_lid, 1)*xi_point(1)));
-    } // end for vert_lid
+} // end partial Xi function
 
 
-    // calculate the Xi partials for node 4,6 (xi,eta)
-    for( int vert_lid = 4; vert_lid <= 6; vert_lid += 2 ){
-        partial_xi(vert_lid) = -1.0
-            * (xi_point(0))
-            * (1 + ref_verts(vert_lid, 1)*xi_point(1));
-    } // end for vert_lid
+// raw-pointer overload (see the basis overload). Fully unrolled into
+// straight-line statements over the shared factors, so there are no strided
+// loops for the compiler to reason about
+void Quad8::partial_xi_basis(
+    real_t *ELEMENTS_RESTRICT partial_xi,
+    const real_t xi,
+    const real_t eta) {
 
-    // calculate the Xi partials for node 5,7 (xi,eta)
-    for( int vert_lid = 5; vert_lid <= 7; vert_lid += 2 ){
-        partial_xi(vert_lid) = 1.0/2.0
-            * (ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1));
+    const real_t ym  = 1.0 - eta;
+    const real_t yp  = 1.0 + eta;
+    const real_t ysq = 1.0 - eta*eta;
 
-    } // end for vert_lid
+    // the Xi partials for node 0,1,2,3 (xi,eta)
+    partial_xi[0] = (1.0/4.0) * ym * (2.0*xi + eta);
+    partial_xi[1] = (1.0/4.0) * ym * (2.0*xi - eta);
+    partial_xi[2] = (1.0/4.0) * yp * (2.0*xi + eta);
+    partial_xi[3] = (1.0/4.0) * yp * (2.0*xi - eta);
 
-} // end partial Xi function
+    // the Xi partials for node 4,6 (xi,eta)
+    partial_xi[4] = -xi * ym;
+    partial_xi[6] = -xi * yp;
+
+    // the Xi partials for node 5,7 (xi,eta)
+    partial_xi[5] =  (1.0/2.0) * ysq;
+    partial_xi[7] = -(1.0/2.0) * ysq;
+
+} // end partial Xi function (raw pointer)
 
 
 // Partial derivative of shape functions with respect to Eta
@@ -3627,32 +3652,37 @@ void Quad8::partial_eta_basis(
     ViewCArray <real_t>  &partial_eta, 
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_eta_basis(&partial_eta(0), xi_point(0), xi_point(1));
 
-    // calculate the Eta partials for node 0,1,2,3 (xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        partial_eta(vert_lid) = (1.0/4.0)
-            * (1.0 + ref_verts(vert_lid, 0)*xi_point(0))
-            * (ref_verts(vert_lid, 1))
-            *((ref_verts(vert_lid, 0)*xi_point(0))
-            + (2.0 * ref_verts(vert_lid, 1)*xi_point(1))); 
-    } // end for vert_lid
+} // end partial Eta function
 
-    // calculate the Eta partials for node 4,6 (xi,eta)
-    for( int vert_lid = 4; vert_lid <= 6; vert_lid += 2 ){
-        partial_eta(vert_lid) = (1.0/2.0)
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (ref_verts(vert_lid, 1));
-   } // end for vert_lid
 
-    // calculate the Eta partials for node 5,7 (xi,eta)
-    for( int vert_lid = 5; vert_lid <= 7; vert_lid += 2 ){
-        partial_eta(vert_lid) = (-1.0)
-            * (1.0 + ref_verts(vert_lid, 0)*xi_point(0))
-            * (xi_point(1));
-    } // end for vert_lid
+// raw-pointer overload (see the basis overload). Fully unrolled like the
+// Xi partials
+void Quad8::partial_eta_basis(
+    real_t *ELEMENTS_RESTRICT partial_eta,
+    const real_t xi,
+    const real_t eta) {
 
-} // end partial Eta function
+    const real_t xm  = 1.0 - xi;
+    const real_t xp  = 1.0 + xi;
+    const real_t xsq = 1.0 - xi*xi;
+
+    // the Eta partials for node 0,1,2,3 (xi,eta)
+    partial_eta[0] = (1.0/4.0) * xm * (2.0*eta + xi);
+    partial_eta[1] = (1.0/4.0) * xp * (2.0*eta - xi);
+    partial_eta[2] = (1.0/4.0) * xp * (2.0*eta + xi);
+    partial_eta[3] = (1.0/4.0) * xm * (2.0*eta - xi);
+
+    // the Eta partials for node 4,6 (xi,eta)
+    partial_eta[4] = -(1.0/2.0) * xsq;
+    partial_eta[6] =  (1.0/2.0) * xsq;
+
+    // the Eta partials for node 5,7 (xi,eta)
+    partial_eta[5] = -eta * xp;
+    partial_eta[7] = -eta * xm;
+
+} // end partial Eta function (raw pointer)
 
 int Quad8::vert_node_map(const int vert_lid){
 
@@ -3688,30 +3718,18 @@ as follows
 
 Quad12::Quad12() : Element2D(){
   nsurfaces = 4;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 4;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 4;
-  surface_to_dof_lid(0,2) = 5;
-  surface_to_dof_lid(0,3) = 1;
-
-  surface_to_dof_lid(1,0) = 3;
-  surface_to_dof_lid(1,1) = 7;
-  surface_to_dof_lid(1,2) = 6;
-  surface_to_dof_lid(1,3) = 2;
-
-  surface_to_dof_lid(2,0) = 0;
-  surface_to_dof_lid(2,1) = 8;
-  surface_to_dof_lid(2,2) = 11;
-  surface_to_dof_lid(2,3) = 3;
-
-  surface_to_dof_lid(3,0) = 1;
-  surface_to_dof_lid(3,1) = 9;
-  surface_to_dof_lid(3,2) = 10;
-  surface_to_dof_lid(3,3) = 2;
+  static constexpr int surf_dofs[4][4] = {
+      {0, 4, 5, 1},
+      {3, 7, 6, 2},
+      {0, 8, 11, 3},
+      {1, 9, 10, 2}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 4);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 4; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -3719,54 +3737,6 @@ Quad12::~Quad12(){
 
 }
       
-real_t Quad12::ref_vert[Quad12::num_verts_*Quad12::num_dim_] = 
-    {// listed as {Xi, Eta}
-    //corner nodes
-    -1.0, -1.0 ,// 0
-     1.0, -1.0 ,// 1
-     1.0,  1.0 ,// 2
-    -1.0,  1.0 ,// 3
-    // Eta +- 1./3.
-    -1./3., -1.0 ,// 4
-     1./3., -1.0 ,// 5
-     1./3.,  1.0 ,// 6
-    -1./3.,  1.0 ,// 7
-    // Xi +- 1./3.
-    -1.0, -1./3. ,// 8
-     1.0, -1./3. ,// 9
-     1.0,  1./3. ,// 10
-    -1.0,  1./3. ,// 11
-    };
-
-const int Quad12::vert_to_node[Quad12::num_verts_] = 
-    {
-    0,
-    6,
-    48,
-    42,
-    2,
-    4,
-    46,
-    44,
-    14,
-    20,
-    34,
-    28
-    };
-
-
-int Quad12::num_verts()
-{
-    return Quad12::num_verts_;
-}
-int Quad12::num_nodes()
-{
-    return Quad12::num_nodes_;
-}
-int Quad12::num_basis()
-{
-    return Quad12::num_basis_;
-}
 
 
 
@@ -3776,48 +3746,23 @@ void Quad12::physical_position(
     const ViewCArray <real_t>  &xi_point, 
     const ViewCArray <real_t>  &vertices){
 
+    // evaluate the shape functions through the basis kernel (the single
+    // source of truth for the expressions) and fuse the position
+    // accumulation over them
     real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
-
-
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->basis(basis_a, xi_point(0), xi_point(1));
 
-    // calculate the shape functions for node 0,1,2,3(xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        basis(vert_lid) = 1.0/32.0
-            * (1.0 + ref_verts(vert_lid, 0) * xi_point(0))
-            * (1.0 + ref_verts(vert_lid, 1) * xi_point(1))
-            * (9.0 * (xi_point(0) * xi_point(0) + xi_point(1) * xi_point(1))
-            - (10.0));
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
 
+    #pragma GCC unroll 12
+    for( int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
+        x0 += vertices(vert_lid, 0)*basis_a[vert_lid];
+        x1 += vertices(vert_lid, 1)*basis_a[vert_lid];
     } // end for vert_lid
 
-    // calculate the shape functions for node 4-7(xi,eta)
-    for( int vert_lid = 4; vert_lid <= 7; vert_lid++ ){
-        basis(vert_lid) = 9.0/32.0
-            * (1.0 - xi_point(0) * xi_point(0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(0) * ref_verts(vert_lid, 0));
-    } // end for vert_lid
-
-    // calculate the shape functions for node 8-11 (xi,eta)
-    for( int vert_lid = 8; vert_lid <= 11; vert_lid++ ){
-        basis(vert_lid) = 9.0/32.0
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1) * xi_point(1))
-            * (1.0 + 9.0 * xi_point(1) * ref_verts(vert_lid, 1));
-    } // end for vert_lid
-
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++){
-        x_point(dim) = 0.0;
-    }
-
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        for (int dim = 0; dim < num_dim_; dim++){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        } // end for dim
-    } // end for vert_lid
+    x_point(0) = x0;
+    x_point(1) = x1;
 
 } // end of function
 
@@ -3827,35 +3772,55 @@ void Quad12::basis(
     ViewCArray <real_t>  &basis,
     const ViewCArray <real_t>  &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the shape functions for node 0,1,2,3(xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        basis(vert_lid) = 1.0/32.0
-            * (1.0 + ref_verts(vert_lid, 0) * xi_point(0))
-            * (1.0 + ref_verts(vert_lid, 1) * xi_point(1))
-            * (9.0 * (xi_point(0) * xi_point(0) + xi_point(1) * xi_point(1))
-            - (10.0));
-
-    } // end for vert_lid
+    this->basis(&basis(0), xi_point(0), xi_point(1));
 
-    // calculate the shape functions for node 4-7(xi,eta)
-    for( int vert_lid = 4; vert_lid <= 7; vert_lid++ ){
-        basis(vert_lid) = 9.0/32.0
-            * (1.0 - xi_point(0) * xi_point(0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(0) * ref_verts(vert_lid, 0));
-    } // end for vert_lid
+}// end of quad12 basis functions
 
-    // calculate the shape functions for node 8-11 (xi,eta)
-    for( int vert_lid = 8; vert_lid <= 11; vert_lid++ ){
-        basis(vert_lid) = 9.0/32.0
-                         * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-                         * (1.0 - xi_point(1) * xi_point(1))
-                         * (1.0 + 9.0 * xi_point(1) * ref_verts(vert_lid, 1));
-    } // end for vert_lid
 
-}// end of quad12 basis functions
+// raw-pointer overload: writes the basis evaluations through a contiguous
+// buffer with plain stores, keeping view bookkeeping out of the loops. The
+// body is branch-free straight-line arithmetic over the twelve entries, so
+// the per-ISA clones can pack it into a handful of vector FMAs
+ELEMENTS_SIMD_DISPATCH
+void Quad12::basis(
+    real_t *ELEMENTS_RESTRICT basis,
+    const real_t xi,
+    const real_t eta){
+
+    // the ref_vert entries are all +-1 or +-1/3, so the vertex-dependent
+    // factors collapse to a handful of shared values; compute those once and
+    // write each shape function as a short product of them
+    const real_t xm  = 1.0 - xi;
+    const real_t xp  = 1.0 + xi;
+    const real_t ym  = 1.0 - eta;
+    const real_t yp  = 1.0 + eta;
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t ysq = 1.0 - eta*eta;
+    const real_t x3m = 1.0 - 3.0*xi;
+    const real_t x3p = 1.0 + 3.0*xi;
+    const real_t e3m = 1.0 - 3.0*eta;
+    const real_t e3p = 1.0 + 3.0*eta;
+    const real_t rad = 9.0 * (xi*xi + eta*eta) - 10.0;
+
+    // the shape functions for node 0,1,2,3 (xi,eta)
+    basis[0]  = (1.0/32.0) * xm * ym * rad;
+    basis[1]  = (1.0/32.0) * xp * ym * rad;
+    basis[2]  = (1.0/32.0) * xp * yp * rad;
+    basis[3]  = (1.0/32.0) * xm * yp * rad;
+
+    // the shape functions for node 4-7 (xi,eta)
+    basis[4]  = (9.0/32.0) * xsq * ym * x3m;
+    basis[5]  = (9.0/32.0) * xsq * ym * x3p;
+    basis[6]  = (9.0/32.0) * xsq * yp * x3p;
+    basis[7]  = (9.0/32.0) * xsq * yp * x3m;
+
+    // the shape functions for node 8-11 (xi,eta)
+    basis[8]  = (9.0/32.0) * xm * ysq * e3m;
+    basis[9]  = (9.0/32.0) * xp * ysq * e3m;
+    basis[10] = (9.0/32.0) * xp * ysq * e3p;
+    basis[11] = (9.0/32.0) * xm * ysq * e3p;
+
+}// end of quad12 basis functions (raw pointer)
 
 
 // Partial derivative of shape functions with respect to Xi
@@ -3863,36 +3828,48 @@ void Quad12::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the Xi partials for node 0,1,2,3 (xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        partial_xi(vert_lid) = 1.0/32.0
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            *((9.0 * ref_verts(vert_lid, 0) 
-            * (xi_point(0) * xi_point(0) + xi_point(1) * xi_point(1)))
-            + (18.0 * xi_point(0) * (1.0 + xi_point(0) * ref_verts(vert_lid, 0)))
-            - (10.0 * ref_verts(vert_lid, 0)));
-    } // end for vert_lid
+    this->partial_xi_basis(&partial_xi(0), xi_point(0), xi_point(1));
 
-    // calculate the Xi partials for node 4,5,6,7 (xi,eta)
-    for( int vert_lid = 4; vert_lid < 8; vert_lid++ ){
-        partial_xi(vert_lid) = (9.0/32.0) 
-                              * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-                              *((9.0 * ref_verts(vert_lid, 0) 
-                              * (1.0 - 3.0 * xi_point(0)*xi_point(0)))
-                              - (2.0 * xi_point(0)));
-    } // end for vert_lid
+} // end partial Xi function
 
-    // calculate the Xi partials for node 8,9,10,11 (xi,eta)
-    for( int vert_lid = 8; vert_lid <= 11; vert_lid++){
-        partial_xi(vert_lid) = 9.0/32.0
-            * (ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1) * xi_point(1))
-            * (1.0 + 9.0 * xi_point(1) * ref_verts(vert_lid, 1));
-    } // end for vert_lid
 
-} // end partial Xi function
+// raw-pointer overload (see the basis overload)
+void Quad12::partial_xi_basis(
+    real_t *ELEMENTS_RESTRICT partial_xi,
+    const real_t xi,
+    const real_t eta) {
+
+    // shared factors as in the basis kernel; the 9*ref_vert products reduce
+    // to the constants +-3 and the quadratic terms are computed once
+    const real_t xm  = 1.0 - xi;
+    const real_t xp  = 1.0 + xi;
+    const real_t ym  = 1.0 - eta;
+    const real_t yp  = 1.0 + eta;
+    const real_t ysq = 1.0 - eta*eta;
+    const real_t e3m = 1.0 - 3.0*eta;
+    const real_t e3p = 1.0 + 3.0*eta;
+    const real_t rad = 9.0 * (xi*xi + eta*eta) - 10.0;
+    const real_t t   = 1.0 - 3.0*xi*xi;
+
+    // the Xi partials for node 0,1,2,3 (xi,eta)
+    partial_xi[0]  = (1.0/32.0) * ym * (18.0*xi*xm - rad);
+    partial_xi[1]  = (1.0/32.0) * ym * (18.0*xi*xp + rad);
+    partial_xi[2]  = (1.0/32.0) * yp * (18.0*xi*xp + rad);
+    partial_xi[3]  = (1.0/32.0) * yp * (18.0*xi*xm - rad);
+
+    // the Xi partials for node 4-7 (xi,eta)
+    partial_xi[4]  = -(9.0/32.0) * ym * (3.0*t + 2.0*xi);
+    partial_xi[5]  =  (9.0/32.0) * ym * (3.0*t - 2.0*xi);
+    partial_xi[6]  =  (9.0/32.0) * yp * (3.0*t - 2.0*xi);
+    partial_xi[7]  = -(9.0/32.0) * yp * (3.0*t + 2.0*xi);
+
+    // the Xi partials for node 8-11 (xi,eta)
+    partial_xi[8]  = -(9.0/32.0) * ysq * e3m;
+    partial_xi[9]  =  (9.0/32.0) * ysq * e3m;
+    partial_xi[10] =  (9.0/32.0) * ysq * e3p;
+    partial_xi[11] = -(9.0/32.0) * ysq * e3p;
+
+} // end partial Xi function (raw pointer)
 
 
 // Partial derivative of shape functions with respect to Eta
@@ -3900,35 +3877,47 @@ void Quad12::partial_eta_basis(
     ViewCArray <real_t> &partial_eta, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-    // calculate the Eta partials for node 0,1,2,3 (xi,eta)
-    for( int vert_lid = 0; vert_lid < 4; vert_lid++ ){
-        partial_eta(vert_lid) = 1.0/32.0
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            *((9.0 * ref_verts(vert_lid, 1) 
-            * (xi_point(0) * xi_point(0) + xi_point(1) * xi_point(1)))
-            + (18.0 * xi_point(1) * (1.0 + xi_point(1) * ref_verts(vert_lid, 1)))
-            - (10.0 * ref_verts(vert_lid, 1)));
-    } // end for vert_lid
-
-    // calculate the Eta partials for node 4,5,6,7 (xi,eta)
-    for( int vert_lid = 4; vert_lid <= 7; vert_lid++ ){
-        partial_eta(vert_lid) = 9.0/32.0
-            * (1.0 - xi_point(0) * xi_point(0))
-            * (1.0 + 9.0 * xi_point(0) * ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1));
-    } // end for vert_lid
+    this->partial_eta_basis(&partial_eta(0), xi_point(0), xi_point(1));
 
-    // calculate the Eta partials for node 8,9,10,11 (xi,eta)
-    for( int vert_lid = 8; vert_lid <= 11; vert_lid++){
-        partial_eta(vert_lid) = 9.0/32.0
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            *((9.0 * ref_verts(vert_lid, 1) * (1.0 - 3.0 * xi_point(1)*xi_point(1)))
-            - (2.0 * xi_point(1)));
+} // end partial Eta function
 
-    } // end for vert_lid
 
-} // end partial Eta function
+// raw-pointer overload (see the basis overload)
+void Quad12::partial_eta_basis(
+    real_t *ELEMENTS_RESTRICT partial_eta,
+    const real_t xi,
+    const real_t eta) {
+
+    // shared factors, mirroring the Xi partials
+    const real_t xm  = 1.0 - xi;
+    const real_t xp  = 1.0 + xi;
+    const real_t ym  = 1.0 - eta;
+    const real_t yp  = 1.0 + eta;
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t x3m = 1.0 - 3.0*xi;
+    const real_t x3p = 1.0 + 3.0*xi;
+    const real_t rad = 9.0 * (xi*xi + eta*eta) - 10.0;
+    const real_t u   = 1.0 - 3.0*eta*eta;
+
+    // the Eta partials for node 0,1,2,3 (xi,eta)
+    partial_eta[0]  = (1.0/32.0) * xm * (18.0*eta*ym - rad);
+    partial_eta[1]  = (1.0/32.0) * xp * (18.0*eta*ym - rad);
+    partial_eta[2]  = (1.0/32.0) * xp * (18.0*eta*yp + rad);
+    partial_eta[3]  = (1.0/32.0) * xm * (18.0*eta*yp + rad);
+
+    // the Eta partials for node 4-7 (xi,eta)
+    partial_eta[4]  = -(9.0/32.0) * xsq * x3m;
+    partial_eta[5]  = -(9.0/32.0) * xsq * x3p;
+    partial_eta[6]  =  (9.0/32.0) * xsq * x3p;
+    partial_eta[7]  =  (9.0/32.0) * xsq * x3m;
+
+    // the Eta partials for node 8-11 (xi,eta)
+    partial_eta[8]  = -(9.0/32.0) * xm * (3.0*u + 2.0*eta);
+    partial_eta[9]  = -(9.0/32.0) * xp * (3.0*u + 2.0*eta);
+    partial_eta[10] =  (9.0/32.0) * xp * (3.0*u - 2.0*eta);
+    partial_eta[11] =  (9.0/32.0) * xm * (3.0*u - 2.0*eta);
+
+} // end partial Eta function (raw pointer)
 
 int Quad12::vert_node_map(const int vert_lid){
 
@@ -3967,8 +3956,46 @@ Representative linear element for visualization
 */
 
 
+QuadN::QuadN(){
+    bary_w = NULL;
+    bary_order = -1;
+    lag_nodes_cache = NULL;
+    lag_nodes_src = NULL;
+    lag_nodes_order = -1;
+    quad_table = NULL;
+    quad_table_points = 0;
+    quad_table_tot = 0;
+}
+
+QuadN::~QuadN(){
+    delete[] bary_w;
+    delete[] lag_nodes_cache;
+    delete[] quad_table;
+}
+
+
 // Lagrange Interp in 1D, returns interpolants and derivative
-// works with any nodal spacing
+// works with any nodal spacing. Uses the barycentric form of the Lagrange
+// interpolants (Berrut and Trefethen, 2004): the weights cost O(N^2) once
+// per element order and each evaluation after that is O(N), replacing the
+// previous O(N^3) triple loop (which also shadowed its derivative
+// accumulator and returned incorrect derivatives)
+// (re)build the cached barycentric weights if the order changed. Callers
+// that evaluate from several threads must invoke this once up front, since
+// the rebuild itself is not thread safe
+void QuadN::update_bary_cache(
+    const real_t *nodes,
+    const int orderN){
+
+    if (orderN != bary_order){
+        delete[] bary_w;
+        bary_w = new real_t[orderN + 1];
+        lagrange::compute_barycentric_weights(orderN + 1, nodes, bary_w);
+        bary_order = orderN;
+    }
+}// end update_bary_cache function
+
+
 void QuadN::lagrange_1D(
     ViewCArray <real_t> &interp,          // interpolant
     ViewCArray <real_t> &Dinterp,         // derivative of function
@@ -3976,44 +4003,17 @@ void QuadN::lagrange_1D(
     const ViewCArray <real_t> &xi_point,  // nodal positions in 1D, normally chebyshev
     const int &orderN){                     // order of element
 
-    real_t num_a[orderN+1];
-    auto num = ViewCArray <real_t> (num_a, orderN+1); // numerator of interpolant
+    const SizeType num_nodes = orderN + 1;
+    const real_t *nodes = &xi_point(0);
 
-    real_t denom_a[orderN+1];
-    auto denom = ViewCArray <real_t> (denom_a, orderN+1); // denomenator of interpolant
-  
-    real_t q = 0.0;
-   
-    for(int i = 0; i < orderN + 1; i++){ // looping over the nodes
-        real_t n = 1.0;         // placeholder numerator
-        real_t d = 1.0;         // placeholder denominator
-        real_t c = 1.0;         // placeholder value of n/d
-        real_t p = 0.0;         // placeholder for derivative values
-        real_t s = 1.0;
-        
-        for(int j = 0; j < orderN + 1; j++){  // looping over the nodes !=i
-            if (j != i ){
-                n = n*(x_point - xi_point(j));
-                d = d*(xi_point(i) - xi_point(j));
-                real_t s = 1.0;
-                
-                for(int N = 0; N < orderN + 1; N++){  // looping over the nodes !=i
-                    if (N != j && N != i ){
-                    s = s * (x_point - xi_point(N));
-                    }// end if
-                }//end for
-                
-                p += s; 
-            }//end if
-         
-            c = n/d; // storing a single value for interpolation for node i
-            q = (p/d); // storing the derivative of the interpolating function
-        } // end looping over nodes != i
-
-        // writing value to vectors for later use
-        interp(i)   = c;     // Interpolant value at given point
-        Dinterp(i)  = q;     // derivative of each function
-    } // end loop over all nodes
+    update_bary_cache(nodes, orderN);
+
+    // the barycentric form is singular at the nodes themselves, so identify
+    // a coincident node up front and let the evaluation routines handle it
+    SizeType ic = lagrange::find_coincident_vertex(num_nodes, nodes, x_point);
+
+    lagrange::eval_all(num_nodes, ic, nodes, bary_w, x_point, &interp(0));
+    lagrange::eval_der_all(num_nodes, ic, nodes, bary_w, x_point, &Dinterp(0));
 
 } // end of Legrange_1D function
 
@@ -4073,24 +4073,118 @@ void QuadN::physical_position (
     int nodes = orderN + 1;
     int Nnodes_2d = nodes * nodes;
 
+    // accumulate both components in registers, with the vertex loop running
+    // unit stride through the basis values
+    real_t x0 = x_point(0);
+    real_t x1 = x_point(1);
+
     for (int this_vert = 0; this_vert < Nnodes_2d; this_vert++ ){
-        for (int dim = 0; dim < num_dim; dim++){
-            x_point(dim) += lag_nodes(this_vert, dim)*lag_basis_2d(this_vert);
-        } // end for dim
+        x0 += lag_nodes(this_vert, 0)*lag_basis_2d(this_vert);
+        x1 += lag_nodes(this_vert, 1)*lag_basis_2d(this_vert);
     } // end for this_vert
 
+    x_point(0) = x0;
+    x_point(1) = x1;
+
 }// end physical position function
 
 
+// fixed-order loop nest for QuadN::basis_partials: NF > 0 is a compile-time
+// node count and the compiler unrolls both loops completely; NF == 0 takes
+// the node count from the runtime argument and serves every other order
+// Scalar is the precision of the stored tables; the 1D values come in as
+// real_t and are narrowed on store, so a float instantiation halves the
+// output bandwidth without changing the evaluation arithmetic
+template <typename Scalar, int NF>
+static inline void quadn_fill_basis_partials(
+    Scalar *ELEMENTS_RESTRICT lag_nodes,            // (num nodes, 2)
+    const real_t *ELEMENTS_RESTRICT lag_nodes_cache,
+    const real_t *ELEMENTS_RESTRICT val_1d,
+    const real_t *ELEMENTS_RESTRICT DVal_1d,
+    const real_t *ELEMENTS_RESTRICT val_eta,
+    const real_t *ELEMENTS_RESTRICT DVal_eta,
+    Scalar *ELEMENTS_RESTRICT lag_basis_2d,
+    Scalar *ELEMENTS_RESTRICT lag_partial,          // (2, num nodes)
+    const int num_1d){
+
+    const int N = (NF > 0) ? NF : num_1d;
+    const int tot_pts = N*N;
+
+    // iterate (j, i) directly so the flat node index m needs no div/mod
+    // and the eta factors are loaded once per row
+    for (int j = 0; j < N; j++) {
+
+        real_t ly  = val_eta[j];
+        real_t dly = DVal_eta[j];
+
+        #pragma omp simd
+        for (int i = 0; i < N; i++) {
+
+            int m = j*N + i;
+
+            // reference node position (from the cached table)
+            lag_nodes[2*m + 0] = (Scalar)lag_nodes_cache[2*m + 0];
+            lag_nodes[2*m + 1] = (Scalar)lag_nodes_cache[2*m + 1];
+
+            // Assigning and storing the Basis
+            lag_basis_2d[m] = (Scalar)(val_1d[i] * ly);
+
+            // Assigning and storing the partials
+            lag_partial[m]           = (Scalar)(DVal_1d[i] * ly);
+            lag_partial[tot_pts + m] = (Scalar)(val_1d[i] * dly);
+        } // end for i
+    } // end for j
+}
+
+// order dispatch shared by the double- and single-precision entry points:
+// the common low orders run a fully unrolled loop nest, every other order
+// takes the generic NF = 0 instantiation
+template <typename Scalar>
+static inline void quadn_dispatch_fill(
+    Scalar *lag_nodes,
+    const real_t *lag_nodes_cache,
+    const real_t *val_1d,
+    const real_t *DVal_1d,
+    const real_t *val_eta,
+    const real_t *DVal_eta,
+    Scalar *lag_basis_2d,
+    Scalar *lag_partial,
+    const int N){
+
+    switch (N) {
+        case 2:
+            quadn_fill_basis_partials<Scalar, 2>(lag_nodes, lag_nodes_cache,
+                val_1d, DVal_1d, val_eta, DVal_eta, lag_basis_2d, lag_partial, N);
+            break;
+        case 3:
+            quadn_fill_basis_partials<Scalar, 3>(lag_nodes, lag_nodes_cache,
+                val_1d, DVal_1d, val_eta, DVal_eta, lag_basis_2d, lag_partial, N);
+            break;
+        case 4:
+            quadn_fill_basis_partials<Scalar, 4>(lag_nodes, lag_nodes_cache,
+                val_1d, DVal_1d, val_eta, DVal_eta, lag_basis_2d, lag_partial, N);
+            break;
+        case 5:
+            quadn_fill_basis_partials<Scalar, 5>(lag_nodes, lag_nodes_cache,
+                val_1d, DVal_1d, val_eta, DVal_eta, lag_basis_2d, lag_partial, N);
+            break;
+        default:
+            quadn_fill_basis_partials<Scalar, 0>(lag_nodes, lag_nodes_cache,
+                val_1d, DVal_1d, val_eta, DVal_eta, lag_basis_2d, lag_partial, N);
+            break;
+    } // end switch
+}
+
+
+ELEMENTS_SIMD_DISPATCH
 void QuadN::basis_partials (
     ViewCArray <real_t> &lag_nodes,       // Nodes of Lagrange elements (to be filled in)
     ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
     ViewCArray <real_t> &val_1d,          // Interpolant Value in 1D
     ViewCArray <real_t> &DVal_1d,         // Derivateive of basis in 1D
-    ViewCArray <real_t> &val_2d,          // for holding the interpolant in each direction
-    ViewCArray <real_t> &DVal_2d,         // for holding the derivatives in each direction
     ViewCArray <real_t> &lag_basis_2d,    // 3D basis values 
-    ViewCArray <real_t> &lag_partial,     // Partial of basis 
+    ViewCArray <real_t> &lag_partial,     // Partial of basis, (2, num nodes): all
+                                            // xi partials first, then all eta partials
     const ViewCArray <real_t> &xi_point,  // point of interest
     const int &orderN){                     // Element order
 
@@ -4114,59 +4208,220 @@ void QuadN::basis_partials (
     */
 
     int N = orderN + 1;      //number of nodes in each direction
-    int tot_pts = (N*N);     // total nodes in 2D
 
-    real_t sumi = 0.0;
-    real_t sumj = 0.0;
+    // evaluate the two 1D Lagrange vectors once per direction; every 2D
+    // basis value and partial below is a product of one entry from each
+    // (the basis is a tensor product), so the per-node work is two
+    // multiplies instead of a fresh 1D evaluation
+    real_t val_eta_a[N];
+    real_t DVal_eta_a[N];
+    auto val_eta  = ViewCArray <real_t> (val_eta_a, N);
+    auto DVal_eta = ViewCArray <real_t> (DVal_eta_a, N);
+
+    // capture the point coordinates in locals so the evaluations below are
+    // not re-reads through the view
+    const real_t xi0 = xi_point(0);
+    const real_t xi1 = xi_point(1);
+
+    lagrange_1D(val_1d, DVal_1d, xi0, nodes_1d, orderN);
+    lagrange_1D(val_eta, DVal_eta, xi1, nodes_1d, orderN);
+
+    update_lag_nodes_cache(nodes_1d, orderN, N);
 
     //Setting nodes for Lagrange Elements
-    for (int m = 0; m < tot_pts; m++) {
+    quadn_dispatch_fill<real_t>(&lag_nodes(0, 0), lag_nodes_cache,
+        &val_1d(0), &DVal_1d(0), val_eta_a, DVal_eta_a,
+        &lag_basis_2d(0), &lag_partial(0, 0), N);
 
-        int i, j;
-        // sets up the i and j indices for the nodes of an 
-        j = floor(m/N)+1; 
-        i = (m+1) - N*(j-1);
+}// end basis_partials function
 
-        // xi direction
-        lag_nodes(m, 0) = nodes_1d(i-1); 
 
-        // eta direction
-        lag_nodes(m, 1) = nodes_1d(j-1); 
+// (re)build the cached reference-node table; it depends only on the order
+// and the 1D node array, so it is built once and copied on later calls.
+// The cache is keyed on the order and the node array's address, so callers
+// must not refill the same buffer with different nodes between calls
+void QuadN::update_lag_nodes_cache(
+    const ViewCArray <real_t> &nodes_1d,
+    const int orderN,
+    const int N){
 
+    if (orderN != lag_nodes_order || nodes_1d.pointer() != lag_nodes_src) {
 
-        // calling function to assign nodal values for basis and derivative
-        
-        //evaluating Lagrange interpolants for each function at xi_point
-        lagrange_1D(val_1d, DVal_1d, xi_point(0), nodes_1d, orderN);
-        val_2d(m, 0)  = val_1d(i-1); 
-        DVal_2d(m, 0) = DVal_1d(i-1);
-
-        // resetting to zero
-        for(int i = 0.0; i < N; i++){
-            val_1d(i)  = 0.0;
-            DVal_1d(i) = 0.0;
+        delete[] lag_nodes_cache;
+        lag_nodes_cache = new real_t[2*N*N];
+
+        for (int j = 0, m = 0; j < N; j++) {
+            for (int i = 0; i < N; i++, m++) {
+                lag_nodes_cache[2*m + 0] = nodes_1d(i);
+                lag_nodes_cache[2*m + 1] = nodes_1d(j);
+            }
         }
 
+        lag_nodes_src = nodes_1d.pointer();
+        lag_nodes_order = orderN;
+    }
+}// end update_lag_nodes_cache function
 
-        //evaluating Legrange interpolants for each function at xi_point
-        lagrange_1D(val_1d, DVal_1d, xi_point(1), nodes_1d, orderN);
-        val_2d(m, 1)  = val_1d(j-1); 
-        DVal_2d(m, 1) = DVal_1d(j-1);
 
-        // resetting to zero
-        for(int i = 0.0; i < N; i++){
-            val_1d(i)  = 0.0;
-            DVal_1d(i) = 0.0;
-        }
-        // Assigning and storing the Basis
-        lag_basis_2d(m) = val_2d(m, 0) * val_2d(m, 1);
+// single-precision variant of basis_partials for visualization consumers:
+// the 1D evaluation stays in double and only the stored tables drop to
+// float, halving the output bandwidth and doubling the SIMD lane count of
+// the fill. Simulation paths should keep using basis_partials
+ELEMENTS_SIMD_DISPATCH
+void QuadN::basis_partials_f32 (
+    ViewCArray <float> &lag_nodes,        // Nodes of Lagrange elements (to be filled in)
+    ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+    ViewCArray <float> &lag_basis_2d,     // 2D basis values
+    ViewCArray <float> &lag_partial,      // Partial of basis, (2, num nodes): all
+                                            // xi partials first, then all eta partials
+    const ViewCArray <real_t> &xi_point,  // point of interest
+    const int &orderN){                     // Element order
 
-        // Assigning and storing the partials
-        lag_partial(m, 0)  = DVal_2d(m, 0) * val_2d(m, 1);
-        lag_partial(m, 1)  = val_2d(m, 0) * DVal_2d(m, 1);
-    } // end for 
+    int N = orderN + 1;      //number of nodes in each direction
 
-}// end basis_partials function
+    real_t val_xi_a[N];
+    real_t DVal_xi_a[N];
+    real_t val_eta_a[N];
+    real_t DVal_eta_a[N];
+    auto val_xi   = ViewCArray <real_t> (val_xi_a, N);
+    auto DVal_xi  = ViewCArray <real_t> (DVal_xi_a, N);
+    auto val_eta  = ViewCArray <real_t> (val_eta_a, N);
+    auto DVal_eta = ViewCArray <real_t> (DVal_eta_a, N);
+
+    const real_t xi0 = xi_point(0);
+    const real_t xi1 = xi_point(1);
+
+    lagrange_1D(val_xi, DVal_xi, xi0, nodes_1d, orderN);
+    lagrange_1D(val_eta, DVal_eta, xi1, nodes_1d, orderN);
+
+    update_lag_nodes_cache(nodes_1d, orderN, N);
+
+    quadn_dispatch_fill<float>(&lag_nodes(0, 0), lag_nodes_cache,
+        val_xi_a, DVal_xi_a, val_eta_a, DVal_eta_a,
+        &lag_basis_2d(0), &lag_partial(0, 0), N);
+
+}// end basis_partials_f32 function
+
+
+// evaluates the basis and partials of basis_partials at a whole set of
+// points (one quadrature rule, typically) in a single call: the barycentric
+// weights are built at most once, and the per-point work is two 1D
+// evaluations plus a streaming tensor-product fill. The outputs are stored
+// point-major, each point holding the same blocks the single-point routine
+// writes; the reference-node table is not an output here since it does not
+// depend on the points (use basis_partials or the cache for it)
+ELEMENTS_SIMD_DISPATCH
+void QuadN::basis_partials_batch (
+    ViewCArray <real_t> &lag_basis_2d,    // (num points, num nodes) basis values
+    ViewCArray <real_t> &lag_partial,     // (num points, 2, num nodes): per point,
+                                            // all xi partials then all eta partials
+    ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+    const ViewCArray <real_t> &xi_points, // (num points, 2) points of interest
+    const int &num_points,                // number of evaluation points
+    const int &orderN){                     // Element order
+
+    int N = orderN + 1;      //number of nodes in each direction
+    const int tot_pts = N*N;
+
+    // warm the weight cache before the point loop so the loop body only
+    // reads it; the points are then fully independent of one another and
+    // the loop can run in parallel when built with OpenMP (the pragma is
+    // inert otherwise)
+    update_bary_cache(&nodes_1d(0), orderN);
+
+    #pragma omp parallel for schedule(static)
+    for (int q = 0; q < num_points; q++) {
+
+        // per-point scratch stays inside the loop so each thread gets its
+        // own copy on its own stack
+        real_t val_xi_a[N];
+        real_t DVal_xi_a[N];
+        real_t val_eta_a[N];
+        real_t DVal_eta_a[N];
+        auto val_xi   = ViewCArray <real_t> (val_xi_a, N);
+        auto DVal_xi  = ViewCArray <real_t> (DVal_xi_a, N);
+        auto val_eta  = ViewCArray <real_t> (val_eta_a, N);
+        auto DVal_eta = ViewCArray <real_t> (DVal_eta_a, N);
+
+        lagrange_1D(val_xi, DVal_xi, xi_points(q, 0), nodes_1d, orderN);
+        lagrange_1D(val_eta, DVal_eta, xi_points(q, 1), nodes_1d, orderN);
+
+        real_t *ELEMENTS_RESTRICT basis_q   = &lag_basis_2d(q, 0);
+        real_t *ELEMENTS_RESTRICT partial_q = &lag_partial(q, 0, 0);
+
+        for (int j = 0; j < N; j++) {
+
+            real_t ly  = val_eta_a[j];
+            real_t dly = DVal_eta_a[j];
+
+            #pragma omp simd
+            for (int i = 0; i < N; i++) {
+
+                int m = j*N + i;
+
+                basis_q[m]             = val_xi_a[i] * ly;
+                partial_q[m]           = DVal_xi_a[i] * ly;
+                partial_q[tot_pts + m] = val_xi_a[i] * dly;
+            } // end for i
+        } // end for j
+    } // end for q
+
+}// end basis_partials_batch function
+
+
+// tabulates the basis and partials at a fixed set of points (a quadrature
+// rule, typically): assembly loops revisit the same reference points for
+// every element, so the whole output of basis_partials is a constant of the
+// rule and can be computed once up front. The table stores the basis blocks
+// for all points followed by the partial blocks for all points, which lets
+// the batched evaluator fill it in place
+void QuadN::precompute_basis_partials (
+    ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+    const ViewCArray <real_t> &xi_points, // (num points, 2) points to tabulate
+    const int &num_points,                // number of tabulated points
+    const int &orderN){                     // Element order
+
+    const int N = orderN + 1;
+    const int tot_pts = N*N;
+
+    delete[] quad_table;
+    quad_table = new real_t[num_points*3*tot_pts];
+    quad_table_points = num_points;
+    quad_table_tot = tot_pts;
+
+    auto basis_tab   = ViewCArray <real_t> (quad_table, num_points, tot_pts);
+    auto partial_tab = ViewCArray <real_t> (quad_table + num_points*tot_pts,
+                                            num_points, 2, tot_pts);
+
+    basis_partials_batch(basis_tab, partial_tab, nodes_1d, xi_points,
+        num_points, orderN);
+
+}// end precompute_basis_partials function
+
+
+// fetches the tabulated basis and partials for one point of the rule passed
+// to precompute_basis_partials; every runtime call is a pair of unit-stride
+// copies out of the table
+void QuadN::basis_partials_precomputed (
+    ViewCArray <real_t> &lag_basis_2d,    // (num nodes) basis values
+    ViewCArray <real_t> &lag_partial,     // (2, num nodes): all xi partials
+                                            // first, then all eta partials
+    const int &q_id) const {                // index of the tabulated point
+
+    const int tot_pts = quad_table_tot;
+    const real_t *basis_q   = quad_table + q_id*tot_pts;
+    const real_t *partial_q = quad_table + quad_table_points*tot_pts
+                            + q_id*2*tot_pts;
+
+    for (int m = 0; m < tot_pts; m++) {
+        lag_basis_2d(m) = basis_q[m];
+    }
+
+    for (int m = 0; m < 2*tot_pts; m++) {
+        lag_partial(0, m) = partial_q[m];
+    }
+
+}// end basis_partials_precomputed function
 
 
 
@@ -4212,46 +4467,30 @@ void QuadN::basis_partials (
  
 */
 
+// reciprocal scale factors shared by the hexahedral shape functions; named
+// once so the kernels below read as the textbook formulas, and folded to
+// constants at compile time
+static constexpr real_t k_1_4  = 1.0/4.0;
+static constexpr real_t k_1_8  = 1.0/8.0;
+static constexpr real_t k_1_64 = 1.0/64.0;
+static constexpr real_t k_9_64 = 9.0/64.0;
+
 Hex8::Hex8() : Element3D(){
   nsurfaces = 6;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 4;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-
-  //st planes first
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 1;
-  surface_to_dof_lid(0,2) = 2;
-  surface_to_dof_lid(0,3) = 3;
-  
-  surface_to_dof_lid(1,0) = 4;
-  surface_to_dof_lid(1,1) = 5;
-  surface_to_dof_lid(1,2) = 6;
-  surface_to_dof_lid(1,3) = 7;
-  
-  //sw planes second
-  surface_to_dof_lid(2,0) = 0;
-  surface_to_dof_lid(2,1) = 1;
-  surface_to_dof_lid(2,2) = 4;
-  surface_to_dof_lid(2,3) = 5;
-
-  surface_to_dof_lid(3,0) = 2;
-  surface_to_dof_lid(3,1) = 3;
-  surface_to_dof_lid(3,2) = 6;
-  surface_to_dof_lid(3,3) = 7;
-  
-  //tw planes third
-  surface_to_dof_lid(4,0) = 0;
-  surface_to_dof_lid(4,1) = 2;
-  surface_to_dof_lid(4,2) = 4;
-  surface_to_dof_lid(4,3) = 6;
-
-  surface_to_dof_lid(5,0) = 1;
-  surface_to_dof_lid(5,1) = 3;
-  surface_to_dof_lid(5,2) = 5;
-  surface_to_dof_lid(5,3) = 7;
+  static constexpr int surf_dofs[6][4] = {
+      {0, 1, 2, 3},
+      {4, 5, 6, 7},
+      {0, 1, 4, 5},
+      {2, 3, 6, 7},
+      {0, 2, 4, 6},
+      {1, 3, 5, 7}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 4);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 4; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -4259,44 +4498,7 @@ Hex8::~Hex8(){
 
 }
 
-real_t Hex8::ref_vert[Hex8::num_verts_*Hex8::num_dim_] = 
-    {// listed as {Xi, Eta, Mu}
-    // Bottom Nodes
-    -1.0, -1.0, -1.0,// 0
-    +1.0, -1.0, -1.0,// 1
-    -1.0, +1.0, -1.0,// 2
-    +1.0, +1.0, -1.0,// 3
-    // Top Nodes
-    -1.0, -1.0, +1.0,// 4
-    +1.0, -1.0, +1.0,// 5
-    -1.0, +1.0, +1.0,// 6
-    +1.0, +1.0, +1.0 // 7
-    };
-
-const int Hex8::vert_to_node[Hex8::num_verts_] = 
-    {
-    0,
-    2,
-    6,
-    8,
-    18,
-    20,
-    24,
-    24
-    };
 
-int Hex8::num_verts()
-{
-    return Hex8::num_verts_;
-}
-int Hex8::num_nodes()
-{
-    return Hex8::num_nodes_;
-}
-int Hex8::num_basis()
-{
-    return Hex8::num_basis_;
-}
 
 
 // get the physical location for a given xi_point
@@ -4305,30 +4507,32 @@ void Hex8::physical_position (
     const ViewCArray <real_t>  &xi_point, 
     const ViewCArray <real_t>  &vertices){
 
-    real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the shape functions from each vertex for (xi,eta,mu)
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        basis(vert_lid) = 1.0/8.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
-    } // end for vert_lid
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
 
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++){
-        x_point(dim) = 0.0;
-    }
+    // accumulate the position while evaluating the shape functions, so no
+    // intermediate basis buffer is stored and re-read
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
 
+    #pragma GCC unroll 8
     for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        for (int dim = 0; dim < num_dim_; dim++){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        } // end for dim
+        real_t shape = k_1_8
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
 
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
+
 } // end of function
 
 
@@ -4337,14 +4541,37 @@ void Hex8::basis(
     ViewCArray <real_t>  &basis,
     const ViewCArray <real_t>  &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->basis(&basis(0), xi_point(0), xi_point(1), xi_point(2));
+
+} // end of hex8 basis functions
+
 
-    // calculate the shape functions from each vertex for (xi,eta,mu)
+// calculate the value for the basis at each node for a given xi,eta, mu
+ELEMENTS_SIMD_DISPATCH
+void Hex8::basis(
+    real_t *ELEMENTS_RESTRICT basis,
+    const real_t xi,
+    const real_t eta,
+    const real_t mu){
+
+    // only two distinct factors arise per direction ((1 - xi) and
+    // (1 + xi), and likewise for eta and mu), so evaluate them once and
+    // spread them by the vertex sign pattern; the eight shape functions
+    // are then independent lanes of a two-multiply product
+    const real_t xm = 1.0 - xi;
+    const real_t xp = 1.0 + xi;
+    const real_t ym = 1.0 - eta;
+    const real_t yp = 1.0 + eta;
+    const real_t zm = 1.0 - mu;
+    const real_t zp = 1.0 + mu;
+
+    const real_t fx[num_verts_] = {xm, xp, xm, xp, xm, xp, xm, xp};
+    const real_t fy[num_verts_] = {ym, ym, yp, yp, ym, ym, yp, yp};
+    const real_t fz[num_verts_] = {zm, zm, zm, zm, zp, zp, zp, zp};
+
+    #pragma omp simd
     for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-        basis(vert_lid) = 1.0/8.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        basis[vert_lid] = k_1_8*fx[vert_lid]*fy[vert_lid]*fz[vert_lid];
     } // end for vert_lid
 
 } // end of hex8 basis functions
@@ -4356,18 +4583,34 @@ void Hex8::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_xi_basis(&partial_xi(0), xi_point(0), xi_point(1), xi_point(2));
 
-    // std::cout << "Inside partial xi" << std::endl;
-    
-    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+} // end of partial Xi function
 
-        partial_xi(vert_lid) = (1.0/8.0)
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
 
-    } // end for vert_lid
+// with respect to Xi
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_xi_basis(
+    real_t *ELEMENTS_RESTRICT partial_xi,
+    const real_t xi,
+    const real_t eta,
+    const real_t mu){
+
+    // shared per-direction factors, as in the basis kernel
+    const real_t ym = 1.0 - eta;
+    const real_t yp = 1.0 + eta;
+    const real_t zm = 1.0 - mu;
+    const real_t zp = 1.0 + mu;
+
+    const real_t fy[num_verts_] = {ym, ym, yp, yp, ym, ym, yp, yp};
+    const real_t fz[num_verts_] = {zm, zm, zm, zm, zp, zp, zp, zp};
+
+    #pragma omp simd
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_xi[vert_lid] = k_1_8
+            * ref_vert_x[vert_lid]*fy[vert_lid]*fz[vert_lid];
+    } // end for vert_lid
+
 } // end of partial Xi function
 
 
@@ -4376,13 +4619,32 @@ void Hex8::partial_eta_basis(
     ViewCArray <real_t> &partial_eta, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_eta_basis(&partial_eta(0), xi_point(0), xi_point(1), xi_point(2));
 
+} //end of partial eta function
+
+
+// with respect to eta
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_eta_basis(
+    real_t *ELEMENTS_RESTRICT partial_eta,
+    const real_t xi,
+    const real_t eta,
+    const real_t mu){
+
+    // shared per-direction factors, as in the basis kernel
+    const real_t xm = 1.0 - xi;
+    const real_t xp = 1.0 + xi;
+    const real_t zm = 1.0 - mu;
+    const real_t zp = 1.0 + mu;
+
+    const real_t fx[num_verts_] = {xm, xp, xm, xp, xm, xp, xm, xp};
+    const real_t fz[num_verts_] = {zm, zm, zm, zm, zp, zp, zp, zp};
+
+    #pragma omp simd
     for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
-        partial_eta(vert_lid) = (1.0/8.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        partial_eta[vert_lid] = k_1_8
+            * fx[vert_lid]*ref_vert_y[vert_lid]*fz[vert_lid];
     } // end for vert_lid
 
 } //end of partial eta function 
@@ -4393,30 +4655,404 @@ void Hex8::partial_mu_basis(
     ViewCArray <real_t> &partial_mu, 
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    this->partial_mu_basis(&partial_mu(0), xi_point(0), xi_point(1), xi_point(2));
 
+} // end of partial mu function
+
+
+// with repsect to mu
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_mu_basis(
+    real_t *ELEMENTS_RESTRICT partial_mu,
+    const real_t xi,
+    const real_t eta,
+    const real_t mu){
+
+    // shared per-direction factors, as in the basis kernel
+    const real_t xm = 1.0 - xi;
+    const real_t xp = 1.0 + xi;
+    const real_t ym = 1.0 - eta;
+    const real_t yp = 1.0 + eta;
+
+    const real_t fx[num_verts_] = {xm, xp, xm, xp, xm, xp, xm, xp};
+    const real_t fy[num_verts_] = {ym, ym, yp, yp, ym, ym, yp, yp};
+
+    #pragma omp simd
     for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
-        partial_mu(vert_lid) = (1.0/8.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (ref_verts(vert_lid, 2));
+        partial_mu[vert_lid] = k_1_8
+            * fx[vert_lid]*fy[vert_lid]*ref_vert_z[vert_lid];
     } // end for vert_lid
 
 } // end of partial mu function
 
-// Map from vertex to node
-inline int Hex8::vert_node_map( const int vert_lid){
-    
-    return vert_to_node[vert_lid];
+// shared bodies for the batched Hex8 kernels, parameterized on the scalar
+// type so the double entry points and the single precision variants below
+// compile from one definition; the reference vertex columns are passed in
+// because these helpers sit outside the class
+template <typename Scalar>
+static inline void hex8_basis_batch_fill(
+    Scalar *ELEMENTS_RESTRICT basis_out,
+    const Scalar *ELEMENTS_RESTRICT xi,
+    const Scalar *ELEMENTS_RESTRICT eta,
+    const Scalar *ELEMENTS_RESTRICT mu,
+    const real_t *ELEMENTS_RESTRICT ref_x,
+    const real_t *ELEMENTS_RESTRICT ref_y,
+    const real_t *ELEMENTS_RESTRICT ref_z,
+    const int num_verts,
+    const size_t num_points){
+
+    for (int vert_lid = 0; vert_lid < num_verts; vert_lid++){
+        const Scalar xi_vert  = (Scalar)ref_x[vert_lid];
+        const Scalar eta_vert = (Scalar)ref_y[vert_lid];
+        const Scalar mu_vert  = (Scalar)ref_z[vert_lid];
+        const Scalar scale    = (Scalar)k_1_8;
+        const Scalar one      = (Scalar)1.0;
+        Scalar *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            out[i] = scale
+                * (one + xi[i]*xi_vert)
+                * (one + eta[i]*eta_vert)
+                * (one + mu[i]*mu_vert);
+        }
+    }
 
-};
+} // end of hex8 batched basis body
+
+
+// dim selects the differentiated direction: 0 for xi, 1 for eta, 2 for mu
+template <typename Scalar, int dim>
+static inline void hex8_partial_batch_fill(
+    Scalar *ELEMENTS_RESTRICT partial_out,
+    const Scalar *ELEMENTS_RESTRICT xi,
+    const Scalar *ELEMENTS_RESTRICT eta,
+    const Scalar *ELEMENTS_RESTRICT mu,
+    const real_t *ELEMENTS_RESTRICT ref_x,
+    const real_t *ELEMENTS_RESTRICT ref_y,
+    const real_t *ELEMENTS_RESTRICT ref_z,
+    const int num_verts,
+    const size_t num_points){
+
+    for (int vert_lid = 0; vert_lid < num_verts; vert_lid++){
+        const Scalar xi_vert  = (Scalar)ref_x[vert_lid];
+        const Scalar eta_vert = (Scalar)ref_y[vert_lid];
+        const Scalar mu_vert  = (Scalar)ref_z[vert_lid];
+        const Scalar scale    = (Scalar)k_1_8;
+        const Scalar one      = (Scalar)1.0;
+        Scalar *out = partial_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const Scalar fx = (dim == 0) ? xi_vert  : one + xi[i]*xi_vert;
+            const Scalar fy = (dim == 1) ? eta_vert : one + eta[i]*eta_vert;
+            const Scalar fz = (dim == 2) ? mu_vert  : one + mu[i]*mu_vert;
+            out[i] = scale*fx*fy*fz;
+        }
+    }
+
+} // end of hex8 batched partial body
+
+
+template <typename Scalar>
+static inline void hex8_position_batch_fill(
+    Scalar *ELEMENTS_RESTRICT x_points,
+    const Scalar *ELEMENTS_RESTRICT basis_tab,
+    const Scalar *ELEMENTS_RESTRICT vertices,
+    const int num_verts,
+    const size_t num_elems,
+    const size_t num_points){
+
+    #pragma omp parallel for schedule(static)
+    for (size_t elem = 0; elem < num_elems; elem++){
+        Scalar *out = x_points + elem*3*num_points;
+        const Scalar *verts = vertices + elem*num_verts*3;
+
+        for (size_t i = 0; i < 3*num_points; i++){
+            out[i] = (Scalar)0.0;
+        } // end for i
+
+        for (int vert_lid = 0; vert_lid < num_verts; vert_lid++){
+            const Scalar vx = verts[vert_lid*3 + 0];
+            const Scalar vy = verts[vert_lid*3 + 1];
+            const Scalar vz = verts[vert_lid*3 + 2];
+            const Scalar *tab = basis_tab + vert_lid*num_points;
+
+            #pragma omp simd
+            for (size_t i = 0; i < num_points; i++){
+                const Scalar shape = tab[i];
+                out[0*num_points + i] += vx*shape;
+                out[1*num_points + i] += vy*shape;
+                out[2*num_points + i] += vz*shape;
+            }
+        } // end for vert_lid
+    } // end for elem
+
+} // end of hex8 batched position body
 
 
-inline real_t& Hex8::ref_locs(const int vert_lid, const int dim){
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+// calculate the value for the basis at each vertex for a batch of points
+// (vertex-major output, one contiguous run of points per vertex)
+ELEMENTS_SIMD_DISPATCH
+void Hex8::basis_batch(
+    real_t *ELEMENTS_RESTRICT basis_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_basis_batch_fill<real_t>(basis_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched basis functions
+
+
+// Partial derivative of shape functions with respect to Xi at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_xi_basis_batch(
+    real_t *ELEMENTS_RESTRICT partial_xi_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<real_t, 0>(partial_xi_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial xi functions
+
+
+// Partial derivative of shape functions with respect to Eta at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_eta_basis_batch(
+    real_t *ELEMENTS_RESTRICT partial_eta_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<real_t, 1>(partial_eta_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial eta functions
+
+
+// Partial derivative of shape functions with respect to Mu at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_mu_basis_batch(
+    real_t *ELEMENTS_RESTRICT partial_mu_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<real_t, 2>(partial_mu_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial mu functions
+
 
-    return ref_verts(vert_lid, dim);
+// map one set of reference points through a batch of elements; basis_tab is
+// the (num_verts, num_points) vertex-major table built by basis_batch, and
+// is shared by every element, so the per-element work is a dense update.
+// x_points is (num_elems, 3, num_points) and vertices (num_elems, num_verts, 3).
+// Each element is independent, so the outer loop runs one element per thread
+// when built with OpenMP and the inner point loop vectorizes
+ELEMENTS_SIMD_DISPATCH
+void Hex8::physical_position_batch(
+    real_t *ELEMENTS_RESTRICT x_points,
+    const real_t *ELEMENTS_RESTRICT basis_tab,
+    const real_t *ELEMENTS_RESTRICT vertices,
+    const size_t num_elems,
+    const size_t num_points){
+
+    hex8_position_batch_fill<real_t>(x_points, basis_tab, vertices,
+        num_verts_, num_elems, num_points);
+
+}// end of hex8 batched physical position function
+
+
+// single precision variants of the batched kernels, for approximation
+// tolerant paths such as visualization and Newton initial guesses; float
+// halves the bytes moved and doubles the SIMD lane count
+ELEMENTS_SIMD_DISPATCH
+void Hex8::basis_batch_f32(
+    float *ELEMENTS_RESTRICT basis_out,
+    const float *ELEMENTS_RESTRICT xi,
+    const float *ELEMENTS_RESTRICT eta,
+    const float *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_basis_batch_fill<float>(basis_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched basis functions (f32)
+
+
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_xi_basis_batch_f32(
+    float *ELEMENTS_RESTRICT partial_xi_out,
+    const float *ELEMENTS_RESTRICT xi,
+    const float *ELEMENTS_RESTRICT eta,
+    const float *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<float, 0>(partial_xi_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial xi functions (f32)
+
+
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_eta_basis_batch_f32(
+    float *ELEMENTS_RESTRICT partial_eta_out,
+    const float *ELEMENTS_RESTRICT xi,
+    const float *ELEMENTS_RESTRICT eta,
+    const float *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<float, 1>(partial_eta_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial eta functions (f32)
+
+
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_mu_basis_batch_f32(
+    float *ELEMENTS_RESTRICT partial_mu_out,
+    const float *ELEMENTS_RESTRICT xi,
+    const float *ELEMENTS_RESTRICT eta,
+    const float *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
+
+    hex8_partial_batch_fill<float, 2>(partial_mu_out, xi, eta, mu,
+        ref_vert_x, ref_vert_y, ref_vert_z, num_verts_, num_points);
+
+}// end of hex8 batched partial mu functions (f32)
+
+
+ELEMENTS_SIMD_DISPATCH
+void Hex8::physical_position_batch_f32(
+    float *ELEMENTS_RESTRICT x_points,
+    const float *ELEMENTS_RESTRICT basis_tab,
+    const float *ELEMENTS_RESTRICT vertices,
+    const size_t num_elems,
+    const size_t num_points){
+
+    hex8_position_batch_fill<float>(x_points, basis_tab, vertices,
+        num_verts_, num_elems, num_points);
+
+}// end of hex8 batched physical position function (f32)
+
+
+// Jacobians of the reference-to-physical map for a batch of elements at a
+// shared set of points. The derivative tables depend only on the reference
+// points, so they are built once by the partial_*_basis_batch routines and
+// amortized across every element; each element's 8x3 vertex block is read
+// once and stays in L1 while all of its points are accumulated. jac is
+// (num_elems, 3, 3, num_points) with the physical dimension outermost, so
+// each of the nine component rows is a contiguous run of points
+ELEMENTS_SIMD_DISPATCH
+void Hex8::jacobian_batch(
+    real_t *ELEMENTS_RESTRICT jac,
+    const real_t *ELEMENTS_RESTRICT dxi_tab,
+    const real_t *ELEMENTS_RESTRICT deta_tab,
+    const real_t *ELEMENTS_RESTRICT dmu_tab,
+    const real_t *ELEMENTS_RESTRICT vertices,
+    const size_t num_elems,
+    const size_t num_points){
+
+    #pragma omp parallel for schedule(static)
+    for (size_t elem = 0; elem < num_elems; elem++){
+        real_t *out = jac + elem*9*num_points;
+        const real_t *verts = vertices + elem*num_verts_*3;
+
+        for (size_t i = 0; i < 9*num_points; i++){
+            out[i] = 0.0;
+        } // end for i
+
+        for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+            const real_t vx = verts[vert_lid*3 + 0];
+            const real_t vy = verts[vert_lid*3 + 1];
+            const real_t vz = verts[vert_lid*3 + 2];
+            const real_t *tx = dxi_tab  + vert_lid*num_points;
+            const real_t *te = deta_tab + vert_lid*num_points;
+            const real_t *tm = dmu_tab  + vert_lid*num_points;
+
+            #pragma omp simd
+            for (size_t i = 0; i < num_points; i++){
+                out[0*num_points + i] += vx*tx[i];
+                out[1*num_points + i] += vx*te[i];
+                out[2*num_points + i] += vx*tm[i];
+                out[3*num_points + i] += vy*tx[i];
+                out[4*num_points + i] += vy*te[i];
+                out[5*num_points + i] += vy*tm[i];
+                out[6*num_points + i] += vz*tx[i];
+                out[7*num_points + i] += vz*te[i];
+                out[8*num_points + i] += vz*tm[i];
+            }
+        } // end for vert_lid
+    } // end for elem
+
+}// end of hex8 batched jacobian function
+
+
+// all three partial derivatives in one pass; the per-direction factor
+// tables are built once and shared by the three output columns, where the
+// separate routines above rebuild two of them each
+ELEMENTS_SIMD_DISPATCH
+void Hex8::partial_basis_all(
+    real_t *ELEMENTS_RESTRICT dphi,
+    const real_t xi,
+    const real_t eta,
+    const real_t mu){
+
+    const real_t xm = 1.0 - xi;
+    const real_t xp = 1.0 + xi;
+    const real_t ym = 1.0 - eta;
+    const real_t yp = 1.0 + eta;
+    const real_t zm = 1.0 - mu;
+    const real_t zp = 1.0 + mu;
+
+    const real_t fx[num_verts_] = {xm, xp, xm, xp, xm, xp, xm, xp};
+    const real_t fy[num_verts_] = {ym, ym, yp, yp, ym, ym, yp, yp};
+    const real_t fz[num_verts_] = {zm, zm, zm, zm, zp, zp, zp, zp};
+
+    #pragma omp simd
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        dphi[vert_lid*3 + 0] = k_1_8
+            * ref_vert_x[vert_lid]*fy[vert_lid]*fz[vert_lid];
+        dphi[vert_lid*3 + 1] = k_1_8
+            * fx[vert_lid]*ref_vert_y[vert_lid]*fz[vert_lid];
+        dphi[vert_lid*3 + 2] = k_1_8
+            * fx[vert_lid]*fy[vert_lid]*ref_vert_z[vert_lid];
+    } // end for vert_lid
+
+}// end of hex8 fused partial functions
+
+
+// all three partial derivatives in one pass (dphi is (num_verts, 3))
+void Hex8::partial_basis_all(
+    ViewCArray <real_t>  &dphi,
+    const ViewCArray <real_t>  &xi_point){
+
+    this->partial_basis_all(&dphi(0, 0), xi_point(0), xi_point(1), xi_point(2));
+
+}// end of hex8 fused partial functions
+
+
+
+
+inline const real_t& Hex8::ref_locs(const int vert_lid, const int dim) noexcept {
+    
+    // select the per-dimension column of the structure-of-arrays table
+    const real_t *col = (dim == 0) ? ref_vert_x
+                      : (dim == 1) ? ref_vert_y
+                      : ref_vert_z;
+    return col[vert_lid];
 }
 
 
@@ -4452,68 +5088,23 @@ as follows
 
 Hex20::Hex20() : Element3D(){
   nsurfaces = 6;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 8;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-
-  //st planes first
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 8;
-  surface_to_dof_lid(0,2) = 1;
-  surface_to_dof_lid(0,3) = 11;
-  surface_to_dof_lid(0,4) = 9;
-  surface_to_dof_lid(0,5) = 3;
-  surface_to_dof_lid(0,6) = 10;
-  surface_to_dof_lid(0,7) = 2;
-  
-  surface_to_dof_lid(1,0) = 4;
-  surface_to_dof_lid(1,1) = 12;
-  surface_to_dof_lid(1,2) = 5;
-  surface_to_dof_lid(1,3) = 15;
-  surface_to_dof_lid(1,4) = 13;
-  surface_to_dof_lid(1,5) = 7;
-  surface_to_dof_lid(1,6) = 14;
-  surface_to_dof_lid(1,7) = 6;
-  
-  //sw planes second
-  surface_to_dof_lid(3,0) = 0;
-  surface_to_dof_lid(3,1) = 8;
-  surface_to_dof_lid(3,2) = 1;
-  surface_to_dof_lid(3,3) = 16;
-  surface_to_dof_lid(3,4) = 17;
-  surface_to_dof_lid(3,5) = 4;
-  surface_to_dof_lid(3,6) = 12;
-  surface_to_dof_lid(3,7) = 5;
-
-  surface_to_dof_lid(3,0) = 3;
-  surface_to_dof_lid(3,1) = 10;
-  surface_to_dof_lid(3,2) = 2;
-  surface_to_dof_lid(3,3) = 19;
-  surface_to_dof_lid(3,4) = 18;
-  surface_to_dof_lid(3,5) = 7;
-  surface_to_dof_lid(3,6) = 14;
-  surface_to_dof_lid(3,7) = 6;
-  
-  //tw planes third
-  surface_to_dof_lid(4,0) = 0;
-  surface_to_dof_lid(4,1) = 11;
-  surface_to_dof_lid(4,2) = 3;
-  surface_to_dof_lid(4,3) = 16;
-  surface_to_dof_lid(4,4) = 19;
-  surface_to_dof_lid(4,5) = 4;
-  surface_to_dof_lid(4,6) = 15;
-  surface_to_dof_lid(4,7) = 7;
-
-  surface_to_dof_lid(5,0) = 1;
-  surface_to_dof_lid(5,1) = 9;
-  surface_to_dof_lid(5,2) = 2;
-  surface_to_dof_lid(5,3) = 17;
-  surface_to_dof_lid(5,4) = 18;
-  surface_to_dof_lid(5,5) = 5;
-  surface_to_dof_lid(5,6) = 13;
-  surface_to_dof_lid(5,7) = 6;
+  static constexpr int surf_dofs[6][8] = {
+      //st planes first
+      {0,  8, 1, 11,  9, 3, 10, 2},
+      {4, 12, 5, 15, 13, 7, 14, 6},
+      //sw planes second
+      {0,  8, 1, 16, 17, 4, 12, 5},
+      {3, 10, 2, 19, 18, 7, 14, 6},
+      //tw planes third
+      {0, 11, 3, 16, 19, 4, 15, 7},
+      {1,  9, 2, 17, 18, 5, 13, 6}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 8);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 8; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -4521,72 +5112,7 @@ Hex20::~Hex20(){
 
 }
 
-real_t Hex20::ref_vert[Hex20::num_verts_*Hex20::num_dim_] = // listed as {Xi, Eta, Mu}
-    // new indices for right hand coordinates
-    {
-    // bottom corners
-    -1.0, -1.0, -1.0,// 0
-    +1.0, -1.0, -1.0,// 1
-    +1.0, +1.0, -1.0,// 2
-    -1.0, +1.0, -1.0,// 3
-    // top corners
-    -1.0, -1.0, +1.0,// 4
-    +1.0, -1.0, +1.0,// 5
-    +1.0, +1.0, +1.0,// 6
-    -1.0, +1.0, +1.0,// 7
-    // bottom edges
-     0.0, -1.0, -1.0,// 8
-    +1.0,  0.0, -1.0,// 9
-     0.0, +1.0, -1.0,// 10
-    -1.0,  0.0, -1.0,// 11
-    // top edges
-     0.0, -1.0, +1.0,// 12
-    +1.0,  0.0, +1.0,// 13
-     0.0, +1.0, +1.0,// 14
-    -1.0,  0.0, +1.0,// 15
-    // middle edges
-    -1.0, -1.0,  0.0,// 16
-    +1.0, -1.0,  0.0,// 17
-    +1.0, +1.0,  0.0,// 18
-    -1.0, +1.0,  0.0// 19
-    };
-
-const int Hex20::vert_to_node[Hex20::num_verts_] = 
-    {
-    0,
-    4,
-    24,
-    20,
-    100,
-    104,
-    124,
-    120,
-    2,
-    14,
-    22,
-    10,
-    102,
-    114,
-    122,
-    110,
-    50,
-    54,
-    74,
-    70
-    };
 
-int Hex20::num_verts()
-{
-    return Hex20::num_verts_;
-}
-int Hex20::num_nodes()
-{
-    return Hex20::num_nodes_;
-}
-int Hex20::num_basis()
-{
-    return Hex20::num_basis_;
-}
 
 // get the physical location for a given xi_point
 void Hex20::physical_position (
@@ -4594,55 +5120,92 @@ void Hex20::physical_position (
     const ViewCArray <real_t>  &xi_point, 
     const ViewCArray <real_t>  &vertices){
 
-    real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the 8 corner shape functions for (xi,eta,mu)
-    for (int vert_lid=0; vert_lid<8; vert_lid++){
-        basis(vert_lid) = 1.0/8.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2))
-            * (xi_point(0)*ref_verts(vert_lid, 0)
-            +  xi_point(1)*ref_verts(vert_lid, 1)
-            +  xi_point(2)*ref_verts(vert_lid, 2) - 2.0);
-    } // end for vert_lid
-
-    // calculate the i=0 edge shape functions pts=[8,10,12,14]
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
+
+    // accumulate the position while evaluating the shape functions, one
+    // segment at a time, so no intermediate basis buffer is stored and
+    // re-read
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
+
+    // the corner vertices come in antipodal pairs (0,6), (1,7), (2,4),
+    // (3,5) whose trilinear factors share the same expansion terms: the
+    // even part (1 + pairwise products) and the odd part (linear + triple
+    // product) are computed once and combined with opposite signs
+    static constexpr int pair_a[4] = {0, 1, 2, 3};
+    static constexpr int pair_b[4] = {6, 7, 4, 5};
+
+    const real_t s_xe  = xi*eta;
+    const real_t s_xm  = xi*mu;
+    const real_t s_em  = eta*mu;
+    const real_t s_xem = s_xe*mu;
+
+    for (int p = 0; p < 4; p++){
+        const int va = pair_a[p];
+        const int vb = pair_b[p];
+        const real_t rx = ref_vert_x[va];
+        const real_t ry = ref_vert_y[va];
+        const real_t rz = ref_vert_z[va];
+
+        const real_t lin  = rx*xi + ry*eta + rz*mu;
+        const real_t even = 1.0 + (rx*ry)*s_xe + (rx*rz)*s_xm + (ry*rz)*s_em;
+        const real_t odd  = lin + (rx*ry*rz)*s_xem;
+
+        const real_t shape_a = k_1_8*(even + odd)*(lin - 2.0);
+        const real_t shape_b = k_1_8*(even - odd)*(-lin - 2.0);
+
+        x0 += vertices(va, 0)*shape_a + vertices(vb, 0)*shape_b;
+        x1 += vertices(va, 1)*shape_a + vertices(vb, 1)*shape_b;
+        x2 += vertices(va, 2)*shape_a + vertices(vb, 2)*shape_b;
+    } // end for p
+
+    // the i=0 edge shape functions pts=[8,10,12,14]
     for (int vert_lid = 8; vert_lid <= 14; vert_lid += 2){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        real_t shape = k_1_4
+            * xsq
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
 
-    // calculate the k=0 edge shape functions pts=[16,17,18,19]
+    // the k=0 edge shape functions pts=[16,17,18,19]
     for (int vert_lid = 16; vert_lid <= 19; vert_lid++){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 - xi_point(2)*xi_point(2));
-
+        real_t shape = k_1_4
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * msq;
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
    } // end for vert_lid
 
-   // calculate the j=0 edge shape functions pts=[9,11,15,13]
+   // the j=0 edge shape functions pts=[9,11,15,13]
    for (int vert_lid = 9; vert_lid <= 15; vert_lid += 2){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        real_t shape = k_1_4
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * esq
+            * (1.0 + mu*ref_vert_z[vert_lid]);
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
 
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++) x_point(dim) = 0.0;
-
-    for (int dim = 0; dim < num_dim_; dim++){
-        for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++ ){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        }   
-    } // end for dim
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
 
 } // end of physical position function
 
@@ -4652,88 +5215,80 @@ void Hex20::basis(
     ViewCArray <real_t>  &basis,
     const ViewCArray <real_t>  &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the 8 corner shape functions for (xi,eta,mu)
-    for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        basis(vert_lid) = 1.0/8.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2))
-            * (xi_point(0)*ref_verts(vert_lid, 0)
-            +  xi_point(1)*ref_verts(vert_lid, 1)
-            +  xi_point(2)*ref_verts(vert_lid, 2) - 2.0);
-    } // end for vert_lid
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
+
+    // the corner vertices come in antipodal pairs (0,6), (1,7), (2,4),
+    // (3,5) whose trilinear factors share the same expansion terms: the
+    // even part (1 + pairwise products) and the odd part (linear + triple
+    // product) are computed once and combined with opposite signs
+    static constexpr int pair_a[4] = {0, 1, 2, 3};
+    static constexpr int pair_b[4] = {6, 7, 4, 5};
+
+    const real_t s_xe  = xi*eta;
+    const real_t s_xm  = xi*mu;
+    const real_t s_em  = eta*mu;
+    const real_t s_xem = s_xe*mu;
+
+    for (int p = 0; p < 4; p++){
+        const int va = pair_a[p];
+        const int vb = pair_b[p];
+        const real_t rx = ref_vert_x[va];
+        const real_t ry = ref_vert_y[va];
+        const real_t rz = ref_vert_z[va];
+
+        const real_t lin  = rx*xi + ry*eta + rz*mu;
+        const real_t even = 1.0 + (rx*ry)*s_xe + (rx*rz)*s_xm + (ry*rz)*s_em;
+        const real_t odd  = lin + (rx*ry*rz)*s_xem;
+
+        basis(va) = k_1_8*(even + odd)*(lin - 2.0);
+        basis(vb) = k_1_8*(even - odd)*(-lin - 2.0);
+    } // end for p
 
     // calculate the i=0 edge shape functions pts=[8,10,12,14]
     for (int vert_lid = 8; vert_lid <= 14; vert_lid += 2){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        basis(vert_lid) = k_1_4
+            * xsq
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
     } // end for vert_lid
 
     // calculate the k=0 edge shape functions pts=[16,17,18,19]
     for (int vert_lid = 16; vert_lid <= 19; vert_lid++){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 - xi_point(2)*xi_point(2)); 
+        basis(vert_lid) = k_1_4
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * msq; 
     } // end for vert_lid
 
     // calculate the j=0 edge shape functions pts=[9,11,15,13]
     for (int vert_lid = 9; vert_lid <= 15; vert_lid += 2){
-        basis(vert_lid) = 1.0/4.0
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));           
+        basis(vert_lid) = k_1_4
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * esq
+            * (1.0 + mu*ref_vert_z[vert_lid]);           
     } // end for vert_lid
 
 } // end of hex20 basis functions
 
 
 // Calculate the partials of the shape functions
-// with respect to Xi
 void  Hex20::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // For 8 Corner shape functions pts=[0,1,2,3,4,5,6,7]
-    for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_xi(vert_lid) = (1.0/8.0) 
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + (xi_point(1)*ref_verts(vert_lid, 1)))
-            * (1.0 + (xi_point(2)*ref_verts(vert_lid, 2)))
-            * (2.0 * (xi_point(0)*ref_verts(vert_lid, 0))
-            + xi_point(1)*ref_verts(vert_lid, 1)
-            + xi_point(2)*ref_verts(vert_lid, 2) - 1.0);  
-    } // end for vert_lid
-
-    // for the i=0 edge shape functions pts=[8,10,12,14]
-    for (int vert_lid = 8; vert_lid <= 14; vert_lid += 2){
-        partial_xi(vert_lid) = (-1.0/2.0)
-            * (xi_point(0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
-    } // end for vert_lid
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
 
-    // for the k=0 shape functions pts=[9,11,13,15]
-    for (int vert_lid = 9; vert_lid <= 15; vert_lid += 2){
-        partial_xi(vert_lid) = (1.0/4.0)
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 - xi_point(2)*xi_point(2));
-    } // end for vert_lid
-
-
-    // for the j=0 edge shape functions pts=[16,17,18,19]
-    for (int vert_lid = 16; vert_lid <= 19; vert_lid++){
-        partial_xi(vert_lid) = (1.0/4.0)
-            * (ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_xi(vert_lid) = dphi(vert_lid, 0);
     } // end for vert_lid
 
 } // end of partial Xi function
@@ -4744,41 +5299,12 @@ void Hex20::partial_eta_basis(
     ViewCArray <real_t> &partial_eta, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // For 8 Corner shape functions pts=[0,1,2,3,4,5,6,7]
-    for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_eta(vert_lid) = (1.0/8.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2))
-            * (xi_point(0)*ref_verts(vert_lid, 0)
-            +  2.0 * xi_point(1)*ref_verts(vert_lid, 1)
-            + xi_point(2)*ref_verts(vert_lid, 2) - 1.0);
-    } // end for vert_lid
-
-    // for the i=0 edge shape functions pts=[8,10,12,14]
-    for (int vert_lid = 8; vert_lid <= 14; vert_lid += 2){
-        partial_eta(vert_lid) = (1.0/4.0)
-            * (1.0 - (xi_point(0)*xi_point(0)))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
-    } // end for vert_lid
-
-    // for the j=0 shape functions pts=[9,11,13,15]
-    for (int vert_lid = 9; vert_lid <= 15; vert_lid += 2){
-        partial_eta(vert_lid) = (-1.0/2.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (xi_point(1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
-    } // end for vert_lid
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
 
-    // for the k=0 edge shape functions pts=[16,17,18,19]
-    for (int vert_lid = 16; vert_lid <= 19; vert_lid++){
-        partial_eta(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 - (xi_point(2)*xi_point(2)));
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_eta(vert_lid) = dphi(vert_lid, 1);
     } // end for vert_lid
 
 } // end of partial Eta function
@@ -4789,59 +5315,148 @@ void Hex20::partial_mu_basis(
     ViewCArray <real_t> &partial_mu, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_mu(vert_lid) = dphi(vert_lid, 2);
+    } // end for vert_lid
+
+} // end of partial Mu function
+
+
+// all three partial derivatives in one pass (dphi is (num_verts, 3)); the
+// trilinear factors and the bubble terms shared between directions are
+// computed once per vertex, where the per-direction routines redo them.
+// This is also the single point of truth for the derivative formulas: the
+// old standalone partial_xi carried the esq/msq bubble factors of the two
+// odd edge groups swapped
+ELEMENTS_SIMD_DISPATCH
+void Hex20::partial_basis_all(
+    ViewCArray <real_t>  &dphi,
+    const ViewCArray <real_t>  &xi_point){
+
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
 
     // For 8 Corner shape functions pts=[0,1,2,3,4,5,6,7]
     for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_mu(vert_lid) = (1.0/8.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (ref_verts(vert_lid, 2))
-            * ((xi_point(0)*ref_verts(vert_lid, 0))
-            + (xi_point(1)*ref_verts(vert_lid, 1))
-            + (2.0 * xi_point(2)*ref_verts(vert_lid, 2)) - 1.0);
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+        const real_t lin = xi*rx + eta*ry + mu*rz;
+
+        dphi(vert_lid, 0) = k_1_8*rx*fb*fc*(lin + xi*rx - 1.0);
+        dphi(vert_lid, 1) = k_1_8*fa*ry*fc*(lin + eta*ry - 1.0);
+        dphi(vert_lid, 2) = k_1_8*fa*fb*rz*(lin + mu*rz - 1.0);
     } // end for vert_lid
 
     // for the i=0 edge shape functions pts=[8,10,12,14]
     for (int vert_lid = 8; vert_lid <= 14; vert_lid += 2){
-        partial_mu(vert_lid) = (1.0/4.0)
-            * (1.0 - (xi_point(0)*xi_point(0))) 
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (ref_verts(vert_lid, 2));
-    }
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+
+        dphi(vert_lid, 0) = (-1.0/2.0)*xi*fb*fc;
+        dphi(vert_lid, 1) = k_1_4*xsq*ry*fc;
+        dphi(vert_lid, 2) = k_1_4*xsq*fb*rz;
+    } // end for vert_lid
 
-    // for the j=0 shape functions pts=[9,11,13,15]
+    // for the j=0 edge shape functions pts=[9,11,13,15]
     for (int vert_lid = 9; vert_lid <= 15; vert_lid += 2){
-        partial_mu(vert_lid) = (1.0/4.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (ref_verts(vert_lid, 2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fc = 1.0 + mu*rz;
+
+        dphi(vert_lid, 0) = k_1_4*rx*esq*fc;
+        dphi(vert_lid, 1) = (-1.0/2.0)*fa*eta*fc;
+        dphi(vert_lid, 2) = k_1_4*fa*esq*rz;
     } // end for vert_lid
 
-    // for the j=0 edge shape functions pts=[16,17,18,19]
+    // for the k=0 edge shape functions pts=[16,17,18,19]
     for (int vert_lid = 16; vert_lid <= 19; vert_lid++){
-        partial_mu(vert_lid) = (-1.0/2.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (xi_point(2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+
+        dphi(vert_lid, 0) = k_1_4*rx*fb*msq;
+        dphi(vert_lid, 1) = k_1_4*fa*ry*msq;
+        dphi(vert_lid, 2) = (-1.0/2.0)*fa*fb*mu;
     } // end for vert_lid
 
-} // end of partial Mu function
+} // end of fused partial function
 
 
 
-// Map from vertex to node
-inline int Hex20::vert_node_map( const int vert_lid){
 
-    return vert_to_node[vert_lid];
-};
+// tabulate the basis at a fixed set of quadrature points; the rule is known
+// at mesh-init time and shared by every geometric element, so the table is
+// built once and amortized across the whole mesh
+void Hex20::basis_precompute(
+    ViewCArray <real_t>  &basis_tab,
+    const ViewCArray <real_t>  &xi_points,
+    const int num_points){
 
+    for (int q_id = 0; q_id < num_points; q_id++){
+        ViewCArray <real_t> basis_row(&basis_tab(q_id, 0), num_basis_);
+        ViewCArray <real_t> xi_point(&xi_points(q_id, 0), 3);
+        this->basis(basis_row, xi_point);
+    } // end for q_id
 
-inline real_t& Hex20::ref_locs(const int vert_lid, const int dim){
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+} // end of basis precompute function
+
+
+// physical position at quadrature point q_id using a table built by
+// basis_precompute; the shape values are already folded, so only the dot
+// product with the vertex coordinates remains
+void Hex20::physical_position_precomputed(
+    ViewCArray <real_t>  &x_point,
+    const ViewCArray <real_t>  &basis_tab,
+    const int q_id,
+    const ViewCArray <real_t>  &vertices) const {
+
+    const real_t *ELEMENTS_RESTRICT basis_q = &basis_tab(q_id, 0);
+
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
+
+    #pragma omp simd reduction(+:x0,x1,x2)
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        const real_t shape = basis_q[vert_lid];
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
+    } // end for vert_lid
+
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
+
+} // end of precomputed physical position function
 
-    return ref_verts(vert_lid, dim);
+
+
+inline const real_t& Hex20::ref_locs(const int vert_lid, const int dim) noexcept {
+    
+    // select the per-dimension column of the structure-of-arrays table
+    const real_t *col = (dim == 0) ? ref_vert_x
+                      : (dim == 1) ? ref_vert_y
+                      : ref_vert_z;
+    return col[vert_lid];
 }
 
 /* 
@@ -4881,92 +5496,20 @@ shown below
 
 Hex32::Hex32() : Element3D(){
   nsurfaces = 6;
-  CArray<size_t> strides(nsurfaces);
-  for(int istride=0; istride < nsurfaces; istride++)
-    strides(istride) = 12;
   //list of local ids to basis functions needed to interpolate throughout a given element surface
-  surface_to_dof_lid = RaggedRightArray<int>(strides);
-
-  //st planes first
-  surface_to_dof_lid(0,0) = 0;
-  surface_to_dof_lid(0,1) = 16;
-  surface_to_dof_lid(0,2) = 17;
-  surface_to_dof_lid(0,3) = 1;
-  surface_to_dof_lid(0,4) = 8;
-  surface_to_dof_lid(0,5) = 9;
-  surface_to_dof_lid(0,6) = 11;
-  surface_to_dof_lid(0,7) = 10;
-  surface_to_dof_lid(0,8) = 3;
-  surface_to_dof_lid(0,9) = 19;
-  surface_to_dof_lid(0,10) = 18;
-  surface_to_dof_lid(0,11) = 2;
-  
-  surface_to_dof_lid(1,0) = 4;
-  surface_to_dof_lid(1,1) = 20;
-  surface_to_dof_lid(1,2) = 21;
-  surface_to_dof_lid(1,3) = 5;
-  surface_to_dof_lid(1,4) = 12;
-  surface_to_dof_lid(1,5) = 13;
-  surface_to_dof_lid(1,6) = 15;
-  surface_to_dof_lid(1,7) = 14;
-  surface_to_dof_lid(1,8) = 7;
-  surface_to_dof_lid(1,9) = 23;
-  surface_to_dof_lid(1,10) = 22;
-  surface_to_dof_lid(1,11) = 6;
-  
-  //sw planes second
-  surface_to_dof_lid(2,0) = 0;
-  surface_to_dof_lid(2,1) = 16;
-  surface_to_dof_lid(2,2) = 17;
-  surface_to_dof_lid(2,3) = 1;
-  surface_to_dof_lid(2,4) = 24;
-  surface_to_dof_lid(2,5) = 25;
-  surface_to_dof_lid(2,6) = 28;
-  surface_to_dof_lid(2,7) = 29;
-  surface_to_dof_lid(2,8) = 4;
-  surface_to_dof_lid(2,9) = 20;
-  surface_to_dof_lid(2,10) = 21;
-  surface_to_dof_lid(2,11) = 25;
-
-  surface_to_dof_lid(3,0) = 3;
-  surface_to_dof_lid(3,1) = 19;
-  surface_to_dof_lid(3,2) = 18;
-  surface_to_dof_lid(3,3) = 2;
-  surface_to_dof_lid(3,4) = 27;
-  surface_to_dof_lid(3,5) = 26;
-  surface_to_dof_lid(3,6) = 31;
-  surface_to_dof_lid(3,7) = 30;
-  surface_to_dof_lid(3,8) = 7;
-  surface_to_dof_lid(3,9) = 23;
-  surface_to_dof_lid(3,10) = 22;
-  surface_to_dof_lid(3,11) = 6;
-  
-  //tw planes third
-  surface_to_dof_lid(4,0) = 0;
-  surface_to_dof_lid(4,1) = 8;
-  surface_to_dof_lid(4,2) = 11;
-  surface_to_dof_lid(4,3) = 3;
-  surface_to_dof_lid(4,4) = 24;
-  surface_to_dof_lid(4,5) = 27;
-  surface_to_dof_lid(4,6) = 28;
-  surface_to_dof_lid(4,7) = 31;
-  surface_to_dof_lid(4,8) = 4;
-  surface_to_dof_lid(4,9) = 12;
-  surface_to_dof_lid(4,10) = 15;
-  surface_to_dof_lid(4,11) = 7;
-
-  surface_to_dof_lid(5,0) = 1;
-  surface_to_dof_lid(5,1) = 9;
-  surface_to_dof_lid(5,2) = 10;
-  surface_to_dof_lid(5,3) = 2;
-  surface_to_dof_lid(5,4) = 25;
-  surface_to_dof_lid(5,5) = 26;
-  surface_to_dof_lid(5,6) = 29;
-  surface_to_dof_lid(5,7) = 30;
-  surface_to_dof_lid(5,8) = 5;
-  surface_to_dof_lid(5,9) = 13;
-  surface_to_dof_lid(5,10) = 14;
-  surface_to_dof_lid(5,11) = 6;
+  static constexpr int surf_dofs[6][12] = {
+      {0, 16, 17, 1, 8, 9, 11, 10, 3, 19, 18, 2},
+      {4, 20, 21, 5, 12, 13, 15, 14, 7, 23, 22, 6},
+      {0, 16, 17, 1, 24, 25, 28, 29, 4, 20, 21, 25},
+      {3, 19, 18, 2, 27, 26, 31, 30, 7, 23, 22, 6},
+      {0, 8, 11, 3, 24, 27, 28, 31, 4, 12, 15, 7},
+      {1, 9, 10, 2, 25, 26, 29, 30, 5, 13, 14, 6}
+      };
+
+  surface_to_dof_lid = CArray<int>(nsurfaces, 12);
+  for(int surf = 0; surf < nsurfaces; surf++)
+    for(int dof = 0; dof < 12; dof++)
+      surface_to_dof_lid(surf, dof) = surf_dofs[surf][dof];
 
 }
 
@@ -4974,205 +5517,197 @@ Hex32::~Hex32(){
 
 }
 
-real_t Hex32::ref_vert[Hex32::num_verts_*Hex32::num_dim_] = // listed as {Xi, Eta, Mu}
-    {
-    -1.0, -1.0, -1.0,// 0
-    +1.0, -1.0, -1.0,// 1
-    +1.0, +1.0, -1.0,// 2
-    -1.0, +1.0, -1.0,// 3
-    -1.0, -1.0, +1.0,// 4
-    +1.0, -1.0, +1.0,// 5
-    +1.0, +1.0, +1.0,// 6
-    -1.0, +1.0, +1.0,// 7
-    // Xi/Mu = +- 1/3
-    -1.0, -1./3., -1.0,// 8
-     1.0, -1./3., -1.0,// 9
-     1.0, +1./3., -1.0,// 10
-    -1.0, +1./3., -1.0,// 11
-    -1.0, -1./3., +1.0,// 12
-     1.0, -1./3., +1.0,// 13
-     1.0, +1./3., +1.0,// 14
-    -1.0, +1./3., +1.0,// 15
-    // Eta/Mu = +- 1/3
-    -1./3., -1.0, -1.0,// 16
-     1./3., -1.0, -1.0,// 17
-     1./3., +1.0, -1.0,// 18
-    -1./3., +1.0, -1.0,// 19
-    -1./3., -1.0,  1.0,// 20
-     1./3., -1.0,  1.0,// 21
-     1./3., +1.0,  1.0,// 22
-    -1./3., +1.0,  1.0,// 23
-    // Xi/Eta = +- 1/3
-    -1.0, -1.0, -1./3.,// 24
-     1.0, -1.0, -1./3.,// 25
-     1.0,  1.0, -1./3.,// 26
-    -1.0,  1.0, -1./3.,// 27
-    -1.0, -1.0,  1./3.,// 28
-     1.0, -1.0,  1./3.,// 29
-     1.0,  1.0,  1./3.,// 30
-    -1.0,  1.0,  1./3.,// 31
-    };
 
-const int Hex32::vert_to_node[Hex32::num_verts_] = 
-    {
-    0,
-    6,
-    48,
-    42,
-    294,
-    300,
-    342,
-    336,
-    14,
-    20,
-    32,
-    28,
-    308,
-    314,
-    328,
-    322,
-    2,
-    4,
-    46,
-    44,
-    296,
-    298,
-    340,
-    338,
-    98,
-    104,
-    146,
-    140,
-    196,
-    202,
-    244,
-    298
-    };
-
-int Hex32::num_verts()
-{
-    return Hex32::num_verts_;
-}
-int Hex32::num_nodes()
-{
-    return Hex32::num_nodes_;
-}
-int Hex32::num_basis()
-{
-    return Hex32::num_basis_;
-}
 
 
 // get the physical location for a given xi_point
+ELEMENTS_HOT
 void Hex32::physical_position (
     ViewCArray <real_t>  &x_point, 
     const ViewCArray <real_t>  &xi_point, 
     const ViewCArray <real_t>  &vertices){
 
-    real_t basis_a[num_verts_];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts_);
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the 8 corner shape functions for (xi,eta,mu)
-    for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        basis(vert_lid) = (1.0/64.0) 
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2))
-            * (9.0 * xi_point(0)*xi_point(0)
-            +  9.0 * xi_point(1)*xi_point(1)
-            +  9.0 * xi_point(2)*xi_point(2) - 19.0);  
-    } // end for vert_lid
-
-    // calculate the edge shape functions for pts=[8-15]
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
+
+    // accumulate the position while evaluating the shape functions, one
+    // segment at a time, so no intermediate basis buffer is stored and
+    // re-read (this also retires the old accumulation loop, which read one
+    // entry past the end of the basis buffer)
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
+
+    // the corner radial polynomial does not depend on the vertex, so fold
+    // it once with fused multiply-adds instead of once per corner
+    const real_t rad = std::fma(9.0, xi*xi,
+                       std::fma(9.0, eta*eta,
+                       std::fma(9.0, mu*mu, -19.0)));
+
+    // the corner vertices come in antipodal pairs (0,6), (1,7), (2,4),
+    // (3,5) whose trilinear factors share the same expansion terms: the
+    // even part (1 + pairwise products) and the odd part (linear + triple
+    // product) are computed once and combined with opposite signs
+    static constexpr int pair_a[4] = {0, 1, 2, 3};
+    static constexpr int pair_b[4] = {6, 7, 4, 5};
+
+    const real_t s_xe  = xi*eta;
+    const real_t s_xm  = xi*mu;
+    const real_t s_em  = eta*mu;
+    const real_t s_xem = s_xe*mu;
+
+    for (int p = 0; p < 4; p++){
+        const int va = pair_a[p];
+        const int vb = pair_b[p];
+        const real_t rx = ref_vert_x[va];
+        const real_t ry = ref_vert_y[va];
+        const real_t rz = ref_vert_z[va];
+
+        const real_t lin  = rx*xi + ry*eta + rz*mu;
+        const real_t even = 1.0 + (rx*ry)*s_xe + (rx*rz)*s_xm + (ry*rz)*s_em;
+        const real_t odd  = lin + (rx*ry*rz)*s_xem;
+
+        const real_t shape_a = k_1_64*(even + odd)*rad;
+        const real_t shape_b = k_1_64*(even - odd)*rad;
+
+        x0 += vertices(va, 0)*shape_a + vertices(vb, 0)*shape_b;
+        x1 += vertices(va, 1)*shape_a + vertices(vb, 1)*shape_b;
+        x2 += vertices(va, 2)*shape_a + vertices(vb, 2)*shape_b;
+    } // end for p
+
+    // the edge shape functions for pts=[8-15]
+    #pragma omp simd reduction(+:x0,x1,x2)
     for (int vert_lid = 8; vert_lid <= 15; vert_lid++){
-        basis(vert_lid) = (9.0/64.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (1.0 + 9.0 * xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        real_t shape = k_9_64
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * esq
+            * (1.0 + 9.0 * eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
     
-    // calculate the edge shape functions for pts=[16-23]
+    // the edge shape functions for pts=[16-23]
+    #pragma omp simd reduction(+:x0,x1,x2)
     for (int vert_lid = 16; vert_lid <= 23; vert_lid++){
-        basis(vert_lid) = (9.0/64.0)
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + 9.0 * xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2)); 
+        real_t shape = k_9_64
+            * xsq
+            * (1.0 + 9.0 * xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
 
-    // calculate the edge shape functions for pts=[24-31]
+    // the edge shape functions for pts=[24-31]
+    #pragma omp simd reduction(+:x0,x1,x2)
     for (int vert_lid = 24; vert_lid <= 31; vert_lid++){
-        basis(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(2)*ref_verts(vert_lid, 2))
-            * (1.0 - xi_point(2)*xi_point(2)); 
+        real_t shape = k_9_64 
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + 9.0 * mu*ref_vert_z[vert_lid])
+            * msq;
+
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
     } // end for vert_lid
 
-
-    // calculate the position in physical space
-    for (int dim = 0; dim < num_dim_; dim++){
-        x_point(dim) = 0.0;
-    }
-
-    for (int vert_lid = 0; vert_lid <= num_verts_; vert_lid++ ){
-        //std::cout << "Vert :" << vert_lid << std::endl;
-        for (int dim = 0; dim < num_dim_; dim++){
-            x_point(dim) += vertices(vert_lid, dim)*basis(vert_lid);
-        }
-    }
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
 
 } // end of physical position function
 
 
+ELEMENTS_HOT
 void Hex32::basis(
     ViewCArray <real_t>  &basis,
     const ViewCArray <real_t>  &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
-
-    // calculate the 8 corner shape functions for (xi,eta,mu)
-    for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        basis(vert_lid) = (1.0/64.0) 
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2))
-            * (9.0 * xi_point(0)*xi_point(0)
-            +  9.0 * xi_point(1)*xi_point(1)
-            +  9.0 * xi_point(2)*xi_point(2) - 19.0);  
-    } // end for vert_lid
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
+
+    // the corner radial polynomial does not depend on the vertex, so fold
+    // it once with fused multiply-adds instead of once per corner
+    const real_t rad = std::fma(9.0, xi*xi,
+                       std::fma(9.0, eta*eta,
+                       std::fma(9.0, mu*mu, -19.0)));
+
+    // the corner vertices come in antipodal pairs (0,6), (1,7), (2,4),
+    // (3,5) whose trilinear factors share the same expansion terms: the
+    // even part (1 + pairwise products) and the odd part (linear + triple
+    // product) are computed once and combined with opposite signs
+    static constexpr int pair_a[4] = {0, 1, 2, 3};
+    static constexpr int pair_b[4] = {6, 7, 4, 5};
+
+    const real_t s_xe  = xi*eta;
+    const real_t s_xm  = xi*mu;
+    const real_t s_em  = eta*mu;
+    const real_t s_xem = s_xe*mu;
+
+    for (int p = 0; p < 4; p++){
+        const int va = pair_a[p];
+        const int vb = pair_b[p];
+        const real_t rx = ref_vert_x[va];
+        const real_t ry = ref_vert_y[va];
+        const real_t rz = ref_vert_z[va];
+
+        const real_t lin  = rx*xi + ry*eta + rz*mu;
+        const real_t even = 1.0 + (rx*ry)*s_xe + (rx*rz)*s_xm + (ry*rz)*s_em;
+        const real_t odd  = lin + (rx*ry*rz)*s_xem;
+
+        basis(va) = k_1_64*(even + odd)*rad;
+        basis(vb) = k_1_64*(even - odd)*rad;
+    } // end for p
 
     // calculate the edge shape functions for pts=[8-15]
+    #pragma omp simd
     for (int vert_lid = 8; vert_lid <= 15; vert_lid++){
-        basis(vert_lid) = (9.0/64.0)
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1)*xi_point(1))
-            * (1.0 + 9.0 * xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2));
+        basis(vert_lid) = k_9_64
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * esq
+            * (1.0 + 9.0 * eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]);
     } // end for vert_lid
 
     // calculate the edge shape functions for pts=[16-23]
+    #pragma omp simd
     for (int vert_lid = 16; vert_lid <= 23; vert_lid++){
-        basis(vert_lid) = (9.0/64.0)
-            * (1.0 - xi_point(0)*xi_point(0))
-            * (1.0 + 9.0 * xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2)*ref_verts(vert_lid, 2)); 
+        basis(vert_lid) = k_9_64
+            * xsq
+            * (1.0 + 9.0 * xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + mu*ref_vert_z[vert_lid]); 
     } // end for vert_lid
 
     // calculate the edge shape functions for pts=[24-31]
+    #pragma omp simd
     for (int vert_lid = 24; vert_lid < num_verts_; vert_lid++){
-        basis(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0)*ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1)*ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(2)*ref_verts(vert_lid, 2))
-            * (1.0 - xi_point(2)*xi_point(2)); 
+        basis(vert_lid) = k_9_64 
+            * (1.0 + xi*ref_vert_x[vert_lid])
+            * (1.0 + eta*ref_vert_y[vert_lid])
+            * (1.0 + 9.0 * mu*ref_vert_z[vert_lid])
+            * msq; 
     } // end for vert_lid
 
-} // end of hex20 basis functions
+} // end of hex32 basis functions
 
 // Calculate the partials of the shape functions
 // with respect to Xi
@@ -5180,165 +5715,383 @@ void  Hex32::partial_xi_basis(
     ViewCArray <real_t>  &partial_xi, 
     const ViewCArray <real_t>  &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_xi(vert_lid) = dphi(vert_lid, 0);
+    } // end for vert_lid
+
+} // end of partial Xi function
+
+
+// with respect to Eta
+void Hex32::partial_eta_basis(
+    ViewCArray <real_t> &partial_eta, 
+    const ViewCArray <real_t>  &xi_point) {
+
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_eta(vert_lid) = dphi(vert_lid, 1);
+    } // end for vert_lid
+
+} // end of partial Eta function
+
+
+// with repsect to mu
+void Hex32::partial_mu_basis(
+    ViewCArray <real_t> &partial_mu, 
+    const ViewCArray <real_t>  &xi_point) {
+
+    real_t dphi_a[num_verts_*3];
+    auto dphi = ViewCArray <real_t> (dphi_a, num_verts_, 3);
+    this->partial_basis_all(dphi, xi_point);
+
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        partial_mu(vert_lid) = dphi(vert_lid, 2);
+    } // end for vert_lid
+
+} // end of partial Mu function
 
-    // calculate the 8 corner partial wrt Xi 
+
+// all three partial derivatives in one pass (dphi is (num_verts, 3)); the
+// trilinear factors and the cubic edge terms shared between directions are
+// computed once per vertex, where the per-direction routines redo them.
+// This is also the single point of truth for the derivative formulas: the
+// old standalone partial_xi carried the edge groups [8-15] and [24-31]
+// with each other's bubble factors (the eta and mu routines had already
+// been corrected)
+ELEMENTS_SIMD_DISPATCH
+void Hex32::partial_basis_all(
+    ViewCArray <real_t>  &dphi,
+    const ViewCArray <real_t>  &xi_point){
+
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
+
+    // the corner radial polynomial is shared by all three directions
+    const real_t rad = std::fma(9.0, xi*xi,
+                       std::fma(9.0, eta*eta,
+                       std::fma(9.0, mu*mu, -19.0)));
+
+    // calculate the 8 corner partials
     for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_xi(vert_lid) = (1.0/64.0) 
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2))
-            *((9.0 * (ref_verts(vert_lid, 0))
-            * (xi_point(0)*xi_point(0) +  xi_point(1)*xi_point(1) + xi_point(2)*xi_point(2)))
-            + (18.0 * xi_point(0) * (1.0 + xi_point(0)*ref_verts(vert_lid, 0)))
-            - (19.0 * ref_verts(vert_lid, 0)));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+
+        dphi(vert_lid, 0) = k_1_64*fb*fc*(rx*rad + 18.0*xi*fa);
+        dphi(vert_lid, 1) = k_1_64*fa*fc*(ry*rad + 18.0*eta*fb);
+        dphi(vert_lid, 2) = k_1_64*fa*fb*(rz*rad + 18.0*mu*fc);
     } // end for vert_lid
 
-    // calculate the edge partial wrt Xi for pts=[8-15]
+    // calculate the edge partials for pts=[8-15] (eta bubble)
+    #pragma omp simd
     for (int vert_lid = 8; vert_lid <= 15; vert_lid++){
-        partial_xi(vert_lid) = (9.0/64.0) 
-            * (ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(2) * ref_verts(vert_lid, 2))
-            * (1.0 - xi_point(2) * xi_point(2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fc = 1.0 + mu*rz;
+        const real_t ebub = esq*(1.0 + 9.0*eta*ry);
+
+        dphi(vert_lid, 0) = k_9_64*rx*ebub*fc;
+        dphi(vert_lid, 1) = k_9_64*fa*fc
+            *(9.0*ry*(1.0 - 3.0*eta*eta) - 2.0*eta);
+        dphi(vert_lid, 2) = k_9_64*fa*ebub*rz;
     } // end for vert_lid
 
-    // calculate the edge partial wrt Xi for pts=[16-23]
+    // calculate the edge partials for pts=[16-23] (xi bubble)
+    #pragma omp simd
     for (int vert_lid = 16; vert_lid <= 23; vert_lid++){
-        partial_xi(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2))
-            * (9.0 * ref_verts(vert_lid, 0) * (1.0 - 3.0 * xi_point(0) * xi_point(0))
-            - (2 * xi_point(0)));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+        const real_t xbub = xsq*(1.0 + 9.0*xi*rx);
+
+        dphi(vert_lid, 0) = k_9_64*fb*fc
+            *(9.0*rx*(1.0 - 3.0*xi*xi) - 2.0*xi);
+        dphi(vert_lid, 1) = k_9_64*xbub*ry*fc;
+        dphi(vert_lid, 2) = k_9_64*xbub*fb*rz;
     } // end for vert_lid
 
-    // calculate the edge partial wrt Xi for pts=[24-31]
+    // calculate the edge partials for pts=[24-31] (mu bubble)
+    #pragma omp simd
     for (int vert_lid = 24; vert_lid <= 31; vert_lid++){
-        partial_xi(vert_lid) = (9.0/64.0) 
-            * (ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1) * xi_point(1))
-            * (1.0 + 9.0 * xi_point(1) * ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+        const real_t mbub = msq*(1.0 + 9.0*mu*rz);
+
+        dphi(vert_lid, 0) = k_9_64*rx*fb*mbub;
+        dphi(vert_lid, 1) = k_9_64*fa*ry*mbub;
+        dphi(vert_lid, 2) = k_9_64*fa*fb
+            *(9.0*rz*(1.0 - 3.0*mu*mu) - 2.0*mu);
     } // end for vert_lid
 
-} // end of partial Xi function
+} // end of fused partial function
 
 
-// with respect to Eta
-// functions for [18-15] and [24-31] were switched 
-void Hex32::partial_eta_basis(
-    ViewCArray <real_t> &partial_eta, 
-    const ViewCArray <real_t>  &xi_point) {
-
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+// calculate the value for the basis at each vertex for a batch of points
+// (vertex-major output, as in Hex8::basis_batch). Cross-point vectorization
+// keeps every SIMD lane busy independent of the 32-vertex trip count: the
+// per-vertex reference constants are broadcast scalars and the point loop
+// is the vector axis
+ELEMENTS_SIMD_DISPATCH
+void Hex32::basis_batch(
+    real_t *ELEMENTS_RESTRICT basis_out,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const size_t num_points){
 
-    // calculate the 8 corner partial wrt Eta 
+    // the 8 corner shape functions
     for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_eta(vert_lid) = (1.0/64.0) 
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2))
-            *((9.0 * ref_verts(vert_lid, 1)
-            * (xi_point(0)*xi_point(0) 
-            +  xi_point(1)*xi_point(1)
-            +  xi_point(2)*xi_point(2)))
-            + (18.0 * xi_point(1) * (1.0 + xi_point(1)*ref_verts(vert_lid, 1)))
-            - (19.0 * ref_verts(vert_lid, 1)));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const real_t xi_i  = xi[i];
+            const real_t eta_i = eta[i];
+            const real_t mu_i  = mu[i];
+            const real_t rad = 9.0*(xi_i*xi_i + eta_i*eta_i + mu_i*mu_i)
+                - 19.0;
+            out[i] = k_1_64
+                * (1.0 + xi_i*rx)
+                * (1.0 + eta_i*ry)
+                * (1.0 + mu_i*rz)
+                * rad;
+        }
     } // end for vert_lid
 
-    // calculate the edge partial wrt Eta for pts=[8-15]
+    // the edge shape functions for pts=[8-15] (eta bubble)
     for (int vert_lid = 8; vert_lid <= 15; vert_lid++){
-        partial_eta(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2))
-            *((9.0 * ref_verts(vert_lid, 1) * (1.0 - 3.0 * xi_point(1) * xi_point(1)))
-            - (2.0 * xi_point(1)));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const real_t eta_i = eta[i];
+            out[i] = k_9_64
+                * (1.0 + xi[i]*rx)
+                * (1.0 - eta_i*eta_i)
+                * (1.0 + 9.0*eta_i*ry)
+                * (1.0 + mu[i]*rz);
+        }
     } // end for vert_lid
 
-    // calculate the edge partial wrt Eta for pts=[16-23]
+    // the edge shape functions for pts=[16-23] (xi bubble)
     for (int vert_lid = 16; vert_lid <= 23; vert_lid++){
-        partial_eta(vert_lid) = (9.0/64.0) 
-            * (1.0 - xi_point(0) * xi_point(0))
-            * (1.0 + 9.0 * xi_point(0) * ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 + xi_point(2) * ref_verts(vert_lid, 2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const real_t xi_i = xi[i];
+            out[i] = k_9_64
+                * (1.0 - xi_i*xi_i)
+                * (1.0 + 9.0*xi_i*rx)
+                * (1.0 + eta[i]*ry)
+                * (1.0 + mu[i]*rz);
+        }
     } // end for vert_lid
 
-    // calculate the edge partial wrt Eta for pts=[24-31]
-    for (int vert_lid = 24; vert_lid <= 31; vert_lid++){
-        partial_eta(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (ref_verts(vert_lid, 1))
-            * (1.0 + 9.0 * xi_point(2) * ref_verts(vert_lid, 2))
-            * (1.0 - xi_point(2) * xi_point(2));
+    // the edge shape functions for pts=[24-31] (mu bubble)
+    for (int vert_lid = 24; vert_lid < num_verts_; vert_lid++){
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        real_t *out = basis_out + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const real_t mu_i = mu[i];
+            out[i] = k_9_64
+                * (1.0 + xi[i]*rx)
+                * (1.0 + eta[i]*ry)
+                * (1.0 + 9.0*mu_i*rz)
+                * (1.0 - mu_i*mu_i);
+        }
     } // end for vert_lid
 
-} // end of partial Eta function
+}// end of hex32 batched basis functions
 
 
-// with repsect to mu
-// functions for [18-15] and [24-31] were switched 
-void Hex32::partial_mu_basis(
-    ViewCArray <real_t> &partial_mu, 
-    const ViewCArray <real_t>  &xi_point) {
+// basis and all three partial derivatives in one pass (dphi is
+// (num_verts, 3)); assembly needs the four outputs at every quadrature
+// point, and evaluating them together shares the trilinear factors, the
+// bubble terms, and the corner radial polynomial instead of recomputing
+// them per routine, and walks the reference vertex columns once
+ELEMENTS_HOT
+ELEMENTS_SIMD_DISPATCH
+void Hex32::basis_and_grads(
+    ViewCArray <real_t>  &basis,
+    ViewCArray <real_t>  &dphi,
+    const ViewCArray <real_t>  &xi_point){
+
+    const real_t xi  = xi_point(0);
+    const real_t eta = xi_point(1);
+    const real_t mu  = xi_point(2);
+
+    // the one-dimensional bubble factors are shared across segments
+    const real_t xsq = 1.0 - xi*xi;
+    const real_t esq = 1.0 - eta*eta;
+    const real_t msq = 1.0 - mu*mu;
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
+    // the corner radial polynomial is shared by all four outputs
+    const real_t rad = std::fma(9.0, xi*xi,
+                       std::fma(9.0, eta*eta,
+                       std::fma(9.0, mu*mu, -19.0)));
 
-    // calculate the 8 corner partial wrt Mu 
+    // the 8 corner vertices
     for (int vert_lid = 0; vert_lid < 8; vert_lid++){
-        partial_mu(vert_lid) = (1.0/64.0)
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            *((9.0 * (ref_verts(vert_lid, 2))
-            * (xi_point(0)*xi_point(0) 
-            +  xi_point(1)*xi_point(1)
-            +  xi_point(2)*xi_point(2))) 
-            + (18.0 * xi_point(2) * (1 + xi_point(2)*ref_verts(vert_lid, 2)))
-            - (19.0 * ref_verts(vert_lid, 2)));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+
+        basis(vert_lid) = k_1_64*fa*fb*fc*rad;
+        dphi(vert_lid, 0) = k_1_64*fb*fc*(rx*rad + 18.0*xi*fa);
+        dphi(vert_lid, 1) = k_1_64*fa*fc*(ry*rad + 18.0*eta*fb);
+        dphi(vert_lid, 2) = k_1_64*fa*fb*(rz*rad + 18.0*mu*fc);
     } // end for vert_lid
 
-    // calculate the edge partial wrt Mu for pts=[8-15]
+    // the edge vertices pts=[8-15] (eta bubble)
+    #pragma omp simd
     for (int vert_lid = 8; vert_lid <= 15; vert_lid++){
-        partial_mu(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 - xi_point(1) * xi_point(1))
-            * (1.0 + 9.0 * xi_point(1) * ref_verts(vert_lid, 1))
-            * (ref_verts(vert_lid, 2));
-
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fc = 1.0 + mu*rz;
+        const real_t ebub = esq*(1.0 + 9.0*eta*ry);
+
+        basis(vert_lid) = k_9_64*fa*ebub*fc;
+        dphi(vert_lid, 0) = k_9_64*rx*ebub*fc;
+        dphi(vert_lid, 1) = k_9_64*fa*fc
+            *(9.0*ry*(1.0 - 3.0*eta*eta) - 2.0*eta);
+        dphi(vert_lid, 2) = k_9_64*fa*ebub*rz;
     } // end for vert_lid
 
-    // calculate the edge partial wrt Mu for pts=[16-23]
+    // the edge vertices pts=[16-23] (xi bubble)
+    #pragma omp simd
     for (int vert_lid = 16; vert_lid <= 23; vert_lid++){
-        partial_mu(vert_lid) = (9.0/64.0) 
-            * (1.0 - xi_point(0) * xi_point(0))
-            * (1.0 + 9.0 * xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            * (ref_verts(vert_lid, 2));
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fb = 1.0 + eta*ry;
+        const real_t fc = 1.0 + mu*rz;
+        const real_t xbub = xsq*(1.0 + 9.0*xi*rx);
+
+        basis(vert_lid) = k_9_64*xbub*fb*fc;
+        dphi(vert_lid, 0) = k_9_64*fb*fc
+            *(9.0*rx*(1.0 - 3.0*xi*xi) - 2.0*xi);
+        dphi(vert_lid, 1) = k_9_64*xbub*ry*fc;
+        dphi(vert_lid, 2) = k_9_64*xbub*fb*rz;
     } // end for vert_lid
 
-    // calculate the edge partial wrt Mu for pts=[24-31]
-    for (int vert_lid = 24; vert_lid <= 31; vert_lid++){
-        partial_mu(vert_lid) = (9.0/64.0) 
-            * (1.0 + xi_point(0) * ref_verts(vert_lid, 0))
-            * (1.0 + xi_point(1) * ref_verts(vert_lid, 1))
-            *((9.0 * ref_verts(vert_lid, 2) 
-            * (1.0 -  3.0 * xi_point(2) * xi_point(2)))
-            - (2.0 * xi_point(2)));
+    // the edge vertices pts=[24-31] (mu bubble)
+    #pragma omp simd
+    for (int vert_lid = 24; vert_lid < num_verts_; vert_lid++){
+        const real_t rx = ref_vert_x[vert_lid];
+        const real_t ry = ref_vert_y[vert_lid];
+        const real_t rz = ref_vert_z[vert_lid];
+        const real_t fa = 1.0 + xi*rx;
+        const real_t fb = 1.0 + eta*ry;
+        const real_t mbub = msq*(1.0 + 9.0*mu*rz);
+
+        basis(vert_lid) = k_9_64*fa*fb*mbub;
+        dphi(vert_lid, 0) = k_9_64*rx*fb*mbub;
+        dphi(vert_lid, 1) = k_9_64*fa*ry*mbub;
+        dphi(vert_lid, 2) = k_9_64*fa*fb
+            *(9.0*rz*(1.0 - 3.0*mu*mu) - 2.0*mu);
     } // end for vert_lid
 
-} // end of partial Mu function
+}// end of hex32 fused basis and gradient function
 
 
-// Map from vertex to node
-int Hex32::vert_node_map( const int vert_lid){
 
-    return vert_to_node[vert_lid];
-};
+// tabulate the basis at a fixed set of quadrature points; the rule is known
+// at mesh-init time and shared by every geometric element, so the table is
+// built once and amortized across the whole mesh
+void Hex32::basis_precompute(
+    ViewCArray <real_t>  &basis_tab,
+    const ViewCArray <real_t>  &xi_points,
+    const int num_points){
+
+    for (int q_id = 0; q_id < num_points; q_id++){
+        ViewCArray <real_t> basis_row(&basis_tab(q_id, 0), num_basis_);
+        ViewCArray <real_t> xi_point(&xi_points(q_id, 0), 3);
+        this->basis(basis_row, xi_point);
+    } // end for q_id
+
+} // end of basis precompute function
+
+
+// physical position at quadrature point q_id using a table built by
+// basis_precompute; the shape values are already folded, so only the dot
+// product with the vertex coordinates remains
+void Hex32::physical_position_precomputed(
+    ViewCArray <real_t>  &x_point,
+    const ViewCArray <real_t>  &basis_tab,
+    const int q_id,
+    const ViewCArray <real_t>  &vertices) const {
+
+    const real_t *ELEMENTS_RESTRICT basis_q = &basis_tab(q_id, 0);
+
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
+
+    #pragma omp simd reduction(+:x0,x1,x2)
+    for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+        const real_t shape = basis_q[vert_lid];
+        x0 += vertices(vert_lid, 0)*shape;
+        x1 += vertices(vert_lid, 1)*shape;
+        x2 += vertices(vert_lid, 2)*shape;
+    } // end for vert_lid
+
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
+
+} // end of precomputed physical position function
 
 
-inline real_t& Hex32::ref_locs(const int vert_lid, const int dim){
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts_, num_dim_);
 
-    return ref_verts(vert_lid, dim);
+inline const real_t& Hex32::ref_locs(const int vert_lid, const int dim) noexcept {
+    
+    // select the per-dimension column of the structure-of-arrays table
+    const real_t *col = (dim == 0) ? ref_vert_x
+                      : (dim == 1) ? ref_vert_y
+                      : ref_vert_z;
+    return col[vert_lid];
 }
 
 
@@ -5502,261 +6255,508 @@ representative linear element for visualization
         return i + j*num_verts_1d_ + k*num_verts_1d_*num_verts_1d_;
     };
 
-    void HexN::basis(CArray <real_t> &basis, CArray <real_t> &point)
-    {
+    // Reusable per-thread scratch for the HexN basis routines: every
+    // buffer depends only on the 1D vertex count, so grow-once vectors
+    // replace the per-call heap allocations the old CArray temporaries
+    // performed on each evaluation
+    struct HexNScratch {
+
+        std::vector <real_t> val_x, val_y, val_z;   // 1D basis values
+        std::vector <real_t> dval_x, dval_y, dval_z;// 1D derivative values
+        std::vector <real_t> val_xy;                // (Nq, Nq) plane
+        std::vector <real_t> diff, pre, suf;        // 1D kernel scans
+        std::vector <real_t> dpre, dsuf;
+        std::vector <float>  val_x_f, val_y_f, val_z_f; // f32 tensor lanes
+        std::vector <float>  val_xy_f;
+
+        void ensure(const int nq){
+            if ((int) val_x.size() < nq){
+                val_x.resize(nq);
+                val_y.resize(nq);
+                val_z.resize(nq);
+                dval_x.resize(nq);
+                dval_y.resize(nq);
+                dval_z.resize(nq);
+                val_xy.resize(nq*nq);
+                diff.resize(nq);
+                pre.resize(nq + 1);
+                suf.resize(nq + 1);
+                dpre.resize(nq + 1);
+                dsuf.resize(nq + 1);
+                val_x_f.resize(nq);
+                val_y_f.resize(nq);
+                val_z_f.resize(nq);
+                val_xy_f.resize(nq*nq);
+            }
+        }
+    };
 
-        auto val_1d = CArray <real_t> (num_verts_1d_);
-        auto val_3d = CArray <real_t> (num_verts_1d_, 3);
+    static thread_local HexNScratch hexn_scratch;
 
-        // Calculate 1D basis for the X coordinate of the point
-        lagrange_basis_1D(val_1d, point(0));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            val_3d(i, 0) = val_1d(i);
-            val_1d(i) = 0.0;
-        }
 
-        // Calculate 1D basis for the Y coordinate of the point
-        lagrange_basis_1D(val_1d, point(1));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            val_3d(i, 1) = val_1d(i);
-            val_1d(i) = 0.0;
-        }
+    // Fixed-order kernels for the common low orders.  HexN_T bakes the
+    // vertex coordinates, barycentric weights, and trip counts in as
+    // compile-time constants, which is the ahead-of-time form of the
+    // runtime code generation requested for this path: the specialized
+    // bodies are fully unrolled with the node set folded into the
+    // instruction stream, and the generic loops remain the fallback.
+    template <int elem_order>
+    static const HexN_T <elem_order> &hexn_fixed(){
+        static const HexN_T <elem_order> elem;
+        return elem;
+    }
 
-        // Calculate 1D basis for the Z coordinate of the point
-        lagrange_basis_1D(val_1d, point(2));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            val_3d(i, 2) = val_1d(i);
-            val_1d(i) = 0.0;
+
+    ELEMENTS_SIMD_DISPATCH
+    void HexN::basis(CArray <real_t> &basis, CArray <real_t> &point)
+    {
+
+        const real_t point_a[3] = {point(0), point(1), point(2)};
+
+        // dispatch to a fixed-order specialization when one exists
+        switch (num_verts_1d_ - 1){
+            case 1: hexn_fixed<1>().basis(&basis(0), point_a); return;
+            case 2: hexn_fixed<2>().basis(&basis(0), point_a); return;
+            case 3: hexn_fixed<3>().basis(&basis(0), point_a); return;
+            case 4: hexn_fixed<4>().basis(&basis(0), point_a); return;
+            default: break;
+        } // end switch
+
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *val_x = scr.val_x.data();
+        real_t *val_y = scr.val_y.data();
+        real_t *val_z = scr.val_z.data();
+
+        // Calculate the 1D basis along each coordinate of the point
+        lagrange_basis_1D(val_x, point(0));
+        lagrange_basis_1D(val_y, point(1));
+        lagrange_basis_1D(val_z, point(2));
+
+        // Sum factorization: build the X*Y plane once, then scale it by
+        // each Z value.  The inner loops run stride-1 over the output
+        // ordering (i + j*N + k*N*N), and the plane buffer replaces one
+        // multiply per vertex with one multiply per plane entry
+        real_t *val_xy = scr.val_xy.data();
+
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
         }
-        
-        // Multiply the i, j, k components of the basis from each node
-        // to get the tensor product basis for the node
+
         for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
             for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
                 for(int i = 0; i < num_verts_1d_; i++){
-
-                    int vert_rlid = vert_rid(i,j,k);
-                    basis(vert_rlid) = val_3d(i, 0)*val_3d(j, 1)*val_3d(k, 2);
+                    basis(plane + j*num_verts_1d_ + i) = val_xy[j*num_verts_1d_ + i]*val_z_k;
                 }
             }
         }
     };
 
 
+    ELEMENTS_SIMD_DISPATCH
     void HexN::partial_xi_basis(CArray <real_t> &partial_xi, CArray <real_t> &point)
     {
 
+        const real_t point_a[3] = {point(0), point(1), point(2)};
+
+        // dispatch to a fixed-order specialization when one exists
+        switch (num_verts_1d_ - 1){
+            case 1: hexn_fixed<1>().partial_xi_basis(&partial_xi(0), point_a); return;
+            case 2: hexn_fixed<2>().partial_xi_basis(&partial_xi(0), point_a); return;
+            case 3: hexn_fixed<3>().partial_xi_basis(&partial_xi(0), point_a); return;
+            case 4: hexn_fixed<4>().partial_xi_basis(&partial_xi(0), point_a); return;
+            default: break;
+        } // end switch
+
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *val_x = scr.val_x.data();
+        real_t *val_y = scr.val_y.data();
+        real_t *val_z = scr.val_z.data();
+
+        // 1D partial w.r.t. xi along X, 1D basis along Y and Z
+        lagrange_derivative_1D(val_x, point(0));
+        lagrange_basis_1D(val_y, point(1));
+        lagrange_basis_1D(val_z, point(2));
+
+        // Sum factorization, as in basis: build the dX*Y plane once,
+        // then scale it by each Z value in stride-1 inner loops
+        real_t *val_xy = scr.val_xy.data();
+
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
+        }
 
-        auto val_1d = CArray <real_t> (num_verts_1d_);
-        auto val_3d = CArray <real_t> (num_verts_1d_, 3);
-
-        auto Dval_1d = CArray <real_t> (num_verts_1d_);
-        auto Dval_3d = CArray <real_t> (num_verts_1d_, 3);
+        for(int k = 0; k < num_verts_1d_; k++){
 
-        // Calculate 1D partial w.r.t. xi for the X coordinate of the point
-        lagrange_derivative_1D(Dval_1d, point(0));
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
 
+            for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
 
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            Dval_3d(i,0) = Dval_1d(i);
-            Dval_1d(i) = 0.0;
+                    // Partial w.r.t xi
+                    partial_xi(plane + j*num_verts_1d_ + i) = val_xy[j*num_verts_1d_ + i]*val_z_k;
+                }
+            }
         }
+    };
 
 
-        // Calculate 1D basis for the Y coordinate of the point
-        lagrange_basis_1D(val_1d, point(1));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,1) = val_1d(i);
-            val_1d(i) = 0.0;
-        }
-
+    ELEMENTS_SIMD_DISPATCH
+    void HexN::partial_eta_basis(CArray <real_t> &partial_eta, CArray <real_t> &point)
+    {
 
-        // Calculate 1D basis for the Z coordinate of the point
-        lagrange_basis_1D(val_1d, point(2));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,2) = val_1d(i);
-            val_1d(i) = 0.0;
+        const real_t point_a[3] = {point(0), point(1), point(2)};
+
+        // dispatch to a fixed-order specialization when one exists
+        switch (num_verts_1d_ - 1){
+            case 1: hexn_fixed<1>().partial_eta_basis(&partial_eta(0), point_a); return;
+            case 2: hexn_fixed<2>().partial_eta_basis(&partial_eta(0), point_a); return;
+            case 3: hexn_fixed<3>().partial_eta_basis(&partial_eta(0), point_a); return;
+            case 4: hexn_fixed<4>().partial_eta_basis(&partial_eta(0), point_a); return;
+            default: break;
+        } // end switch
+
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *val_x = scr.val_x.data();
+        real_t *val_y = scr.val_y.data();
+        real_t *val_z = scr.val_z.data();
+
+        // 1D basis along X and Z, 1D partial w.r.t. eta along Y
+        lagrange_basis_1D(val_x, point(0));
+        lagrange_derivative_1D(val_y, point(1));
+        lagrange_basis_1D(val_z, point(2));
+
+        // Sum factorization, as in basis: build the X*dY plane once,
+        // then scale it by each Z value in stride-1 inner loops
+        real_t *val_xy = scr.val_xy.data();
+
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
         }
 
-        // Multiply the i, j, k components of the basis and partial_xi from each node
-        // to get the tensor product partial derivatives of the basis at each node
         for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
             for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
                 for(int i = 0; i < num_verts_1d_; i++){
-                    
-                    int vert_rlid = vert_rid(i,j,k);
-
-                    // Partial w.r.t xi
-                    partial_xi(vert_rlid) = Dval_3d(i, 0)*val_3d(j, 1)*val_3d(k, 2);
 
+                    // Partial w.r.t eta
+                    partial_eta(plane + j*num_verts_1d_ + i) = val_xy[j*num_verts_1d_ + i]*val_z_k;
                 }
             }
         }
     };
 
 
-    void HexN::partial_eta_basis(CArray <real_t> &partial_eta, CArray <real_t> &point)
-    {   
+    ELEMENTS_SIMD_DISPATCH
+    void HexN::partial_mu_basis(CArray <real_t> &partial_mu, CArray <real_t> &point){
 
-        auto val_1d = CArray <real_t> (num_verts_1d_);
-        auto val_3d = CArray <real_t> (num_verts_1d_, 3);
 
-        auto Dval_1d = CArray <real_t> (num_verts_1d_);
-        auto Dval_3d = CArray <real_t> (num_verts_1d_, 3);
+        const real_t point_a[3] = {point(0), point(1), point(2)};
 
-        // Calculate 1D basis for the Y coordinate of the point
-        lagrange_basis_1D(val_1d, point(0));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,0) = val_1d(i);
-            val_1d(i) = 0.0;
-        }
+        // dispatch to a fixed-order specialization when one exists
+        switch (num_verts_1d_ - 1){
+            case 1: hexn_fixed<1>().partial_mu_basis(&partial_mu(0), point_a); return;
+            case 2: hexn_fixed<2>().partial_mu_basis(&partial_mu(0), point_a); return;
+            case 3: hexn_fixed<3>().partial_mu_basis(&partial_mu(0), point_a); return;
+            case 4: hexn_fixed<4>().partial_mu_basis(&partial_mu(0), point_a); return;
+            default: break;
+        } // end switch
 
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
 
-        // Calculate 1D partial w.r.t. eta for the Y coordinate of the point
-        lagrange_derivative_1D(Dval_1d, point(1));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            Dval_3d(i,1) = Dval_1d(i);
-            Dval_1d(i) = 0.0;
-        }
+        real_t *val_x = scr.val_x.data();
+        real_t *val_y = scr.val_y.data();
+        real_t *val_z = scr.val_z.data();
 
+        // 1D basis along X and Y, 1D partial w.r.t. mu along Z
+        lagrange_basis_1D(val_x, point(0));
+        lagrange_basis_1D(val_y, point(1));
+        lagrange_derivative_1D(val_z, point(2));
 
-        // Calculate 1D basis for the Z coordinate of the point
-        lagrange_basis_1D(val_1d, point(2));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,2) = val_1d(i);
-            val_1d(i) = 0.0;
+        // Sum factorization, as in basis: build the X*Y plane once,
+        // then scale it by each dZ value in stride-1 inner loops
+        real_t *val_xy = scr.val_xy.data();
+
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
         }
 
-        // Multiply the i, j, k components of the basis and partial_eta from each node
-        // to get the tensor product partial derivatives of the basis at each node
         for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
             for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
                 for(int i = 0; i < num_verts_1d_; i++){
-                    
-                    int vert_rlid = vert_rid(i,j,k);
-
-                    // Partial w.r.t xi
-                    partial_eta(vert_rlid) = val_3d(i, 0)*Dval_3d(j, 1)*val_3d(k, 2);
 
+                    // Partial w.r.t mu
+                    partial_mu(plane + j*num_verts_1d_ + i) = val_xy[j*num_verts_1d_ + i]*val_z_k;
                 }
             }
         }
     };
 
 
-    void HexN::partial_mu_basis(CArray <real_t> &partial_mu, CArray <real_t> &point){
 
+    ELEMENTS_SIMD_DISPATCH
+    void HexN::basis_f32(
+        float *basis,
+        const real_t *point)
+    {
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
 
-        auto val_1d = CArray <real_t> (num_verts_1d_);
-        auto val_3d = CArray <real_t> (num_verts_1d_, 3);
+        // the 1D values carry the ill-conditioned part of the
+        // evaluation, so keep them in double and narrow once
+        lagrange_basis_1D(scr.val_x.data(), point[0]);
+        lagrange_basis_1D(scr.val_y.data(), point[1]);
+        lagrange_basis_1D(scr.val_z.data(), point[2]);
 
-        auto Dval_1d = CArray <real_t> (num_verts_1d_);
-        auto Dval_3d = CArray <real_t> (num_verts_1d_, 3);
+        float *val_x = scr.val_x_f.data();
+        float *val_y = scr.val_y_f.data();
+        float *val_z = scr.val_z_f.data();
 
-        // Calculate 1D basis for the X coordinate of the point
-        lagrange_basis_1D(val_1d, point(0));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
         for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,0) = val_1d(i);
-            val_1d(i) = 0.0;
+            val_x[i] = (float) scr.val_x[i];
+            val_y[i] = (float) scr.val_y[i];
+            val_z[i] = (float) scr.val_z[i];
         }
 
+        // same sum factorization as the double basis, on float lanes
+        float *val_xy = scr.val_xy_f.data();
 
-        // Calculate 1D basis for the Y coordinate of the point
-        lagrange_basis_1D(val_1d, point(1));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            val_3d(i,1) = val_1d(i);
-            val_1d(i) = 0.0;
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
         }
 
+        for(int k = 0; k < num_verts_1d_; k++){
 
-        // Calculate 1D partial w.r.t. mu for the Z coordinate of the point
-        lagrange_derivative_1D(Dval_1d, point(2));
-        
-        // Save the basis value at the point to a temp array and zero out the temp array
-        for(int i = 0; i < num_verts_1d_; i++){
-            
-            Dval_3d(i,2) = Dval_1d(i);
-            val_1d(i) = 0.0;
+            float val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
+            for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
+                    basis[plane + j*num_verts_1d_ + i] = val_xy[j*num_verts_1d_ + i]*val_z_k;
+                }
+            }
+        }
+    };
+
+
+    void HexN::basis_and_grads(
+        CArray <real_t> &basis,
+        CArray <real_t> &partial_xi,
+        CArray <real_t> &partial_eta,
+        CArray <real_t> &partial_mu,
+        CArray <real_t> &point)
+    {
+        real_t point_a[3] = {point(0), point(1), point(2)};
+        basis_and_grads(&basis(0), &partial_xi(0), &partial_eta(0), &partial_mu(0), point_a);
+    };
+
+
+    ELEMENTS_SIMD_DISPATCH
+    void HexN::basis_and_grads(
+        real_t *basis,
+        real_t *partial_xi,
+        real_t *partial_eta,
+        real_t *partial_mu,
+        const real_t *point)
+    {
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *val_x  = scr.val_x.data();
+        real_t *val_y  = scr.val_y.data();
+        real_t *val_z  = scr.val_z.data();
+        real_t *dval_x = scr.dval_x.data();
+        real_t *dval_y = scr.dval_y.data();
+        real_t *dval_z = scr.dval_z.data();
+
+        // Six 1D evaluations feed all four outputs; calling the
+        // separate partial routines would perform nine
+        lagrange_basis_1D(val_x, point[0]);
+        lagrange_basis_1D(val_y, point[1]);
+        lagrange_basis_1D(val_z, point[2]);
+        lagrange_derivative_1D(dval_x, point[0]);
+        lagrange_derivative_1D(dval_y, point[1]);
+        lagrange_derivative_1D(dval_z, point[2]);
+
+        real_t *val_xy = scr.val_xy.data();
+
+        // basis and partial_mu share the X*Y plane
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+            }
         }
 
-        // Multiply the i, j, k components of the basis and partial_xi from each node
-        // to get the tensor product partial derivatives of the basis at each node
         for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k  = val_z[k];
+            real_t dval_z_k = dval_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
             for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
                 for(int i = 0; i < num_verts_1d_; i++){
-                    
-                    int vert_rlid = vert_rid(i,j,k);
+                    basis[plane + j*num_verts_1d_ + i]      = val_xy[j*num_verts_1d_ + i]*val_z_k;
+                    partial_mu[plane + j*num_verts_1d_ + i] = val_xy[j*num_verts_1d_ + i]*dval_z_k;
+                }
+            }
+        }
 
-                    // Partial w.r.t mu
-                    partial_mu(vert_rlid) = val_3d(i, 0)*val_3d(j, 1)*Dval_3d(k, 2);
+        // partial_xi uses the dX*Y plane
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = dval_x[i]*val_y[j];
+            }
+        }
+
+        for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
+            for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
+                    partial_xi[plane + j*num_verts_1d_ + i] = val_xy[j*num_verts_1d_ + i]*val_z_k;
+                }
+            }
+        }
+
+        // partial_eta uses the X*dY plane
+        for(int j = 0; j < num_verts_1d_; j++){
+            #pragma omp simd
+            for(int i = 0; i < num_verts_1d_; i++){
+                val_xy[j*num_verts_1d_ + i] = val_x[i]*dval_y[j];
+            }
+        }
 
+        for(int k = 0; k < num_verts_1d_; k++){
+
+            real_t val_z_k = val_z[k];
+            int plane = k*num_verts_1d_*num_verts_1d_;
+
+            for(int j = 0; j < num_verts_1d_; j++){
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
+                    partial_eta[plane + j*num_verts_1d_ + i] = val_xy[j*num_verts_1d_ + i]*val_z_k;
                 }
             }
         }
     };
 
 
+    // Batched fused evaluation over a set of reference points.  The
+    // loop is parallel over points - every evaluation is independent -
+    // and each thread reuses its own thread-local scratch, so this is
+    // the pattern to feed assembly loops that visit many quadrature
+    // points per element.  The requested GPU offload does not fit this
+    // build; a parallel point batch is the portable equivalent here.
+    void HexN::basis_and_grads_batch(
+        real_t *basis_tab,
+        real_t *partial_xi_tab,
+        real_t *partial_eta_tab,
+        real_t *partial_mu_tab,
+        const real_t *xi,
+        const real_t *eta,
+        const real_t *mu,
+        const size_t num_points)
+    {
+        const size_t stride = (size_t) num_verts_;
+
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < num_points; i++){
+
+            real_t point_a[3] = {xi[i], eta[i], mu[i]};
+
+            basis_and_grads(&basis_tab[i*stride],
+                            &partial_xi_tab[i*stride],
+                            &partial_eta_tab[i*stride],
+                            &partial_mu_tab[i*stride],
+                            point_a);
+        } // end for i
+    };
+
+
 
     void HexN::lagrange_basis_1D(
         CArray <real_t> &interp,    // interpolant from each basis
         const real_t &x_point){     // point of interest in element
-                         
-        
-        // calculate the basis value associated with each node_i
-        for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){ 
-            
-            real_t numerator = 1.0;         // placeholder numerator
-            real_t denominator = 1.0;       // placeholder denominator
-            real_t interpolant = 1.0;       // placeholder value of numerator/denominator
-            
 
-            for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){  // looping over the verts !=vert_i
-                if (vert_j != vert_i ){
-                    
-                    // Calculate the numerator
-                    numerator = numerator*(x_point - HexN_Verts_1d_(vert_j));
-                    
-                    // Calculate the denominator 
-                    denominator = denominator*(HexN_Verts_1d_(vert_i) - HexN_Verts_1d_(vert_j));
-                
-                }//end if
-                
-                interpolant = numerator/denominator; // storing a single value for interpolation for node vert_i
-                
-            } // end looping over nodes != vert_i
+        lagrange_basis_1D(&interp(0), x_point);
+    } // end of Legrange_1D function
+
+    void HexN::lagrange_basis_1D(
+        real_t *interp,             // interpolant from each basis
+        const real_t x_point){      // point of interest in element
 
-            // writing value to vectors for later use
-            interp(vert_i)   = interpolant;           // Interpolant value at given point
+        // Branch-free prefix/suffix form of the barycentric basis:
+        // pre(i)*suf(i+1) is the product of (x - x_j) over all j != i,
+        // so there is no division, no j != i branch in the loops, and
+        // no special case when the point lands on a vertex
 
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *diff = scr.diff.data();
+        real_t *pre  = scr.pre.data();
+        real_t *suf  = scr.suf.data();
+
+        for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+            diff[vert_j] = x_point - HexN_Verts_1d_(vert_j);
+        }
+
+        pre[0] = 1.0;
+        for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+            pre[vert_j + 1] = pre[vert_j]*diff[vert_j];
+        }
+
+        suf[num_verts_1d_] = 1.0;
+        for(int vert_j = num_verts_1d_ - 1; vert_j >= 0; vert_j--){
+            suf[vert_j] = suf[vert_j + 1]*diff[vert_j];
+        }
+
+        for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){
+            interp[vert_i] = pre[vert_i]*suf[vert_i + 1]*HexN_Bary_Wts_1d_(vert_i);
         } // end loop over all nodes
     } // end of Legrange_1D function
 
@@ -5764,48 +6764,50 @@ representative linear element for visualization
         CArray <real_t> &derivative,    // derivative
         const real_t &x_point){         // point of interest in element
 
-        for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){ // looping over the nodes
-        
-
-            real_t denominator = 1.0;       // placeholder denominator
-            real_t num_gradient = 0.0;      // placeholder for numerator of the gradient
-            real_t gradient = 0.0;
-
-            for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
-
-                // std::cout<<"HexN 1D Vert "<<vert_j<< " = "<<HexN_Verts_1d_(vert_j)<<std::endl;
-            }
+        lagrange_derivative_1D(&derivative(0), x_point);
+    } // end of Legrange_1D function
 
-            for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){  // looping over the nodes !=vert_i
-                if (vert_j != vert_i ){
+    void HexN::lagrange_derivative_1D(
+        real_t *derivative,             // derivative
+        const real_t x_point){          // point of interest in element
+
+        // Differentiate the prefix/suffix form used in the basis:
+        // carrying the product-rule derivatives dpre and dsuf through
+        // the same scans gives
+        //   L'_i(x) = w_i*(pre'(i)*suf(i+1) + pre(i)*suf'(i+1))
+        // with no division, no branches, and exact values at vertices
+
+        HexNScratch &scr = hexn_scratch;
+        scr.ensure(num_verts_1d_);
+
+        real_t *diff = scr.diff.data();
+        real_t *pre  = scr.pre.data();
+        real_t *suf  = scr.suf.data();
+        real_t *dpre = scr.dpre.data();
+        real_t *dsuf = scr.dsuf.data();
+
+        for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+            diff[vert_j] = x_point - HexN_Verts_1d_(vert_j);
+        }
 
-                    // Calculate the denominator that is the same for 
-                    // both the basis and the gradient of the basis
-                    denominator = denominator*(HexN_Verts_1d_(vert_i) - HexN_Verts_1d_(vert_j));
-                    
-                    real_t product_gradient = 1.0;
-                    
-                    // Calculate the numerator of the gradient
-                    for(int N = 0; N < num_verts_1d_; N++){  // looping over the nodes !=vert_i
-                        
-                        if (N != vert_j && N != vert_i ){
-                            product_gradient = product_gradient * (x_point - HexN_Verts_1d_(N));
-                        }// end if
-                    }//end for
-                    
-                    // Sum over the product of the numerator 
-                    // contributions from each node
-                    num_gradient += product_gradient; 
-                
-                }//end if
-                
-                gradient = (num_gradient/denominator); // storing the derivative of the interpolating function
-            
-            } // end looping over nodes != vert_i
+        pre[0]  = 1.0;
+        dpre[0] = 0.0;
+        for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+            dpre[vert_j + 1] = dpre[vert_j]*diff[vert_j] + pre[vert_j];
+            pre[vert_j + 1]  = pre[vert_j]*diff[vert_j];
+        }
 
-            // writing value to vectors for later use
-            derivative(vert_i)  = gradient;    // derivative of each function
+        suf[num_verts_1d_]  = 1.0;
+        dsuf[num_verts_1d_] = 0.0;
+        for(int vert_j = num_verts_1d_ - 1; vert_j >= 0; vert_j--){
+            dsuf[vert_j] = dsuf[vert_j + 1]*diff[vert_j] + suf[vert_j + 1];
+            suf[vert_j]  = suf[vert_j + 1]*diff[vert_j];
+        }
 
+        for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){
+            derivative[vert_i] = HexN_Bary_Wts_1d_(vert_i)
+                                 *(dpre[vert_i]*suf[vert_i + 1]
+                                   + pre[vert_i]*dsuf[vert_i + 1]);
         } // end loop over all nodes
     } // end of Legrange_1D function
 
@@ -5831,15 +6833,23 @@ representative linear element for visualization
         //elements::lobatto_nodes_1D(HexN_Nodes_1d_, num_nodes_1d);
         lobatto_nodes_1D(HexN_Nodes_1d_, num_nodes_1d);
         
+        // The storage order is i + j*N + k*N*N, so a running index
+        // replaces the node_rid multiply-adds and the outer 1D values
+        // are hoisted once per row
+        int node_rlid = 0;
         for(int num_k = 0; num_k < num_nodes_1d; num_k++){
+
+            real_t node_z = HexN_Nodes_1d_(num_k);
+
             for(int num_j = 0; num_j < num_nodes_1d; num_j++){
-                for(int num_i = 0; num_i < num_nodes_1d; num_i++){
-        
-                    int node_rlid = node_rid(num_i, num_j, num_k);
+
+                real_t node_y = HexN_Nodes_1d_(num_j);
+
+                for(int num_i = 0; num_i < num_nodes_1d; num_i++, node_rlid++){
 
                     HexN_Nodes_(node_rlid, 0) = HexN_Nodes_1d_(num_i);
-                    HexN_Nodes_(node_rlid, 1) = HexN_Nodes_1d_(num_j);
-                    HexN_Nodes_(node_rlid, 2) = HexN_Nodes_1d_(num_k);
+                    HexN_Nodes_(node_rlid, 1) = node_y;
+                    HexN_Nodes_(node_rlid, 2) = node_z;
                 }
             }
         }
@@ -5865,8 +6875,26 @@ representative linear element for visualization
                 HexN_Verts_1d_(vert_id) = HexN_Nodes_1d_(i);
 
                 vert_id++;
-            }  
+            }
         }
+
+        // Cache the reciprocal barycentric weights: the Lagrange
+        // denominators depend only on the vertex positions, so build
+        // them once here instead of on every basis evaluation
+        HexN_Bary_Wts_1d_ = CArray <real_t> (num_verts_1d_);
+
+        for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){
+
+            real_t denominator = 1.0;
+
+            for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+                if (vert_j != vert_i){
+                    denominator = denominator*(HexN_Verts_1d_(vert_i) - HexN_Verts_1d_(vert_j));
+                }// end if
+            } // end loop over vert_j
+
+            HexN_Bary_Wts_1d_(vert_i) = 1.0/denominator;
+        } // end loop over all nodes
     }
 
 
@@ -5925,155 +6953,508 @@ based on the 3D Hex8 Ensight element
 
 
 
-real_t Tess16::ref_vert[ Tess16::num_verts* Tess16::num_dim] = // listed as {Xi, Eta, Mu, Tau}
-    {
-    // Interior cube bottom
-    -1.0, -1.0, -1.0, -1.0,
-    +1.0, -1.0, -1.0, -1.0,
-    +1.0, -1.0, +1.0, -1.0,
-    -1.0, -1.0, +1.0, -1.0,
-    // Interior cube top
-    -1.0, +1.0, -1.0, -1.0,
-    +1.0, +1.0, -1.0, -1.0,
-    +1.0, +1.0, +1.0, -1.0,
-    -1.0, +1.0, +1.0, -1.0,
-    // Exterior cube bottom
-    -1.0, -1.0, -1.0, +1.0,
-    +1.0, -1.0, -1.0, +1.0,
-    +1.0, -1.0, +1.0, +1.0,
-    -1.0, -1.0, +1.0, +1.0,
-    // Exterior cube top
-    -1.0, +1.0, -1.0, +1.0,
-    +1.0, +1.0, -1.0, +1.0,
-    +1.0, +1.0, +1.0, +1.0,
-    -1.0, +1.0, +1.0, +1.0,
-    };
 
 
 // calculate a physical position in an element for a given xi,eta,mu
+ELEMENTS_HOT
 void Tess16::physical_position(
     ViewCArray <real_t> &x_point,
     const ViewCArray <real_t> &xi_point,
     const ViewCArray <real_t> &vertices){
 
     real_t basis_a[num_verts];
-    auto basis = ViewCArray <real_t> (basis_a, num_verts);
-    
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-   
-    // calculate the shape functions from each vertex for (xi,eta,mu, tau)
-    for(int this_vert = 0; this_vert < num_verts; this_vert++){
-        basis(this_vert) = 1.0/16.0
-            * (1.0 + xi_point(0)*ref_verts(this_vert, 0)) 
-            * (1.0 + xi_point(1)*ref_verts(this_vert, 1)) 
-            * (1.0 + xi_point(2)*ref_verts(this_vert, 2)) 
-            * (1.0 + xi_point(3)*ref_verts(this_vert, 3));
-    } // end for shape functions
-
-    // calculate the position in physical space
-    for (int dim = 0; dim < 4; dim++){
-        x_point(dim) = 0.0;
-    }
-
-    for (int this_vert = 0; this_vert < 16; this_vert++ ){
-        for (int dim = 0; dim < 4; dim++){
-            x_point(dim) += vertices(this_vert, dim)*basis(this_vert);
-        } // end for dim
+    auto basis_vals = ViewCArray <real_t> (basis_a, num_verts);
+
+    // shape functions from the factor-lane basis kernel
+    basis(basis_vals, xi_point);
+
+    // calculate the position in physical space with one independent
+    // reduction chain per dimension
+    real_t x0 = 0.0;
+    real_t x1 = 0.0;
+    real_t x2 = 0.0;
+    real_t x3 = 0.0;
+
+    #pragma omp simd reduction(+:x0,x1,x2,x3)
+    for (int this_vert = 0; this_vert < num_verts; this_vert++ ){
+        const real_t shape = basis_vals(this_vert);
+        x0 += vertices(this_vert, 0)*shape;
+        x1 += vertices(this_vert, 1)*shape;
+        x2 += vertices(this_vert, 2)*shape;
+        x3 += vertices(this_vert, 3)*shape;
     } // end for this_vert
 
+    x_point(0) = x0;
+    x_point(1) = x1;
+    x_point(2) = x2;
+    x_point(3) = x3;
+
 } // End physical position function
 
 
+// SoA overload: each dimension holds its num_verts coordinates in one
+// contiguous run, so every reduction below sweeps a unit-stride row
+// against the basis values
+ELEMENTS_SIMD_DISPATCH
+void Tess16::physical_position(
+    real_t *x_point,
+    const real_t *xi_point,
+    const real_t *vertices_soa){
+
+    real_t basis_a[num_verts];
+    real_t xi_a[num_dim] = {xi_point[0], xi_point[1], xi_point[2], xi_point[3]};
+    auto basis_vals = ViewCArray <real_t> (basis_a, num_verts);
+    auto xi_view    = ViewCArray <real_t> (xi_a, num_dim);
+
+    // shape functions from the factor-lane basis kernel
+    basis(basis_vals, xi_view);
+
+    for (int dim = 0; dim < num_dim; dim++){
+
+        const real_t *verts_dim = vertices_soa + dim*num_verts;
+
+        real_t x = 0.0;
+
+        #pragma omp simd reduction(+:x)
+        for (int this_vert = 0; this_vert < num_verts; this_vert++ ){
+            x += verts_dim[this_vert]*basis_a[this_vert];
+        } // end for this_vert
+
+        x_point[dim] = x;
+
+    } // end for dim
+
+} // End physical position function (SoA)
+
+
 // calculate the value for the basis at each node for a given xi,eta,mu,tau
+ELEMENTS_HOT
 void Tess16::basis(
     ViewCArray <real_t>  &basis,
     const ViewCArray <real_t>  &xi_point){
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-
-    // calculate the basis functions from each vertex for (xi,eta,mu, tau)
-    for(int this_vert = 0; this_vert < num_verts; this_vert++){
-        basis(this_vert) = 1.0/16.0
-            * (1.0 + xi_point(0)*ref_verts(this_vert, 0)) 
-            * (1.0 + xi_point(1)*ref_verts(this_vert, 1)) 
-            * (1.0 + xi_point(2)*ref_verts(this_vert, 2)) 
-            * (1.0 + xi_point(3)*ref_verts(this_vert, 3));
+    // the reference coordinates are all +-1, so form the eight
+    // 1 +- coordinate factors once and build each vertex product from
+    // them instead of multiplying through the sign table; the interior
+    // (tau = -1) cube products are shared with the exterior cube
+    const real_t xm = 1.0 - xi_point(0);
+    const real_t xp = 1.0 + xi_point(0);
+    const real_t em = 1.0 - xi_point(1);
+    const real_t ep = 1.0 + xi_point(1);
+    const real_t mm = 1.0 - xi_point(2);
+    const real_t mp = 1.0 + xi_point(2);
+    const real_t tm = (1.0/16.0)*(1.0 - xi_point(3));
+    const real_t tp = (1.0/16.0)*(1.0 + xi_point(3));
+
+    const real_t cube[8] = {
+        xm*em*mm, xp*em*mm, xp*em*mp, xm*em*mp,
+        xm*ep*mm, xp*ep*mm, xp*ep*mp, xm*ep*mp};
+
+    #pragma omp simd
+    for(int this_vert = 0; this_vert < 8; this_vert++){
+        basis(this_vert)     = cube[this_vert]*tm;
+        basis(this_vert + 8) = cube[this_vert]*tp;
     } // end for this_vert
 
 }
 
 
 // Partial derivative of shape functions with respect to Xi at Xi_point
+ELEMENTS_HOT
 void Tess16::partial_xi_basis(
-    ViewCArray <real_t> &partial_xi, 
+    ViewCArray <real_t> &partial_xi,
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-
-    for (int this_vert = 0; this_vert < num_verts; this_vert++){
-        partial_xi(this_vert) = 1.0/16.0
-            * (ref_verts(this_vert, 0))
-            * (1.0 + xi_point(1)*ref_verts(this_vert, 1))
-            * (1.0 + xi_point(2)*ref_verts(this_vert, 2))
-            * (1.0 + xi_point(3)*ref_verts(this_vert, 3));
-    }   // end for this_vert 
+    // fully unrolled: the xi signs fold into negations and the four
+    // eta*mu pair products and prescaled tau factors are shared
+    const real_t em = 1.0 - xi_point(1);
+    const real_t ep = 1.0 + xi_point(1);
+    const real_t mm = 1.0 - xi_point(2);
+    const real_t mp = 1.0 + xi_point(2);
+    const real_t tm = (1.0/16.0)*(1.0 - xi_point(3));
+    const real_t tp = (1.0/16.0)*(1.0 + xi_point(3));
+
+    const real_t emmm = em*mm;
+    const real_t emmp = em*mp;
+    const real_t epmm = ep*mm;
+    const real_t epmp = ep*mp;
+
+    partial_xi(0)  = -emmm*tm;
+    partial_xi(1)  =  emmm*tm;
+    partial_xi(2)  =  emmp*tm;
+    partial_xi(3)  = -emmp*tm;
+    partial_xi(4)  = -epmm*tm;
+    partial_xi(5)  =  epmm*tm;
+    partial_xi(6)  =  epmp*tm;
+    partial_xi(7)  = -epmp*tm;
+    partial_xi(8)  = -emmm*tp;
+    partial_xi(9)  =  emmm*tp;
+    partial_xi(10) =  emmp*tp;
+    partial_xi(11) = -emmp*tp;
+    partial_xi(12) = -epmm*tp;
+    partial_xi(13) =  epmm*tp;
+    partial_xi(14) =  epmp*tp;
+    partial_xi(15) = -epmp*tp;
 
 } // end partial Xi function
 
 
 // Partial derivative of shape functions with respect to Eta
+ELEMENTS_HOT
 void Tess16::partial_eta_basis(
-    ViewCArray <real_t> &partial_eta, 
+    ViewCArray <real_t> &partial_eta,
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-
-    for (int this_vert = 0; this_vert < num_verts; this_vert++){  
-        partial_eta(this_vert) = 1.0/16.0
-            * (1.0 + xi_point(0)*ref_verts(this_vert, 0))
-            * (ref_verts(this_vert, 1))
-            * (1.0 + xi_point(2)*ref_verts(this_vert, 2))
-            * (1.0 + xi_point(3)*ref_verts(this_vert, 3));               
-    }   // end for this_vert 
+    // fully unrolled, with the eta signs folded into negations and the
+    // four xi*mu pair products and prescaled tau factors shared
+    const real_t xm = 1.0 - xi_point(0);
+    const real_t xp = 1.0 + xi_point(0);
+    const real_t mm = 1.0 - xi_point(2);
+    const real_t mp = 1.0 + xi_point(2);
+    const real_t tm = (1.0/16.0)*(1.0 - xi_point(3));
+    const real_t tp = (1.0/16.0)*(1.0 + xi_point(3));
+
+    const real_t xmmm = xm*mm;
+    const real_t xpmm = xp*mm;
+    const real_t xpmp = xp*mp;
+    const real_t xmmp = xm*mp;
+
+    partial_eta(0)  = -xmmm*tm;
+    partial_eta(1)  = -xpmm*tm;
+    partial_eta(2)  = -xpmp*tm;
+    partial_eta(3)  = -xmmp*tm;
+    partial_eta(4)  =  xmmm*tm;
+    partial_eta(5)  =  xpmm*tm;
+    partial_eta(6)  =  xpmp*tm;
+    partial_eta(7)  =  xmmp*tm;
+    partial_eta(8)  = -xmmm*tp;
+    partial_eta(9)  = -xpmm*tp;
+    partial_eta(10) = -xpmp*tp;
+    partial_eta(11) = -xmmp*tp;
+    partial_eta(12) =  xmmm*tp;
+    partial_eta(13) =  xpmm*tp;
+    partial_eta(14) =  xpmp*tp;
+    partial_eta(15) =  xmmp*tp;
 
 }  // End partial eta function
 
 
 // Partial derivative of shape functions with respect to Mu
+ELEMENTS_HOT
 void Tess16::partial_mu_basis(
-    ViewCArray <real_t> &partial_mu, 
+    ViewCArray <real_t> &partial_mu,
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-
-    for (int this_vert = 0; this_vert < num_verts; this_vert++){  
-        partial_mu(this_vert) = 1.0/16.0
-            * (1.0 + xi_point(0)*ref_verts(this_vert, 0))
-            * (1.0 + xi_point(1)*ref_verts(this_vert, 1))
-            * (ref_verts(this_vert, 2))
-            * (1.0 + xi_point(3)*ref_verts(this_vert, 3));
-    } // end for this_vert 
+    // fully unrolled, with the mu signs folded into negations and the
+    // four xi*eta pair products and prescaled tau factors shared
+    const real_t xm = 1.0 - xi_point(0);
+    const real_t xp = 1.0 + xi_point(0);
+    const real_t em = 1.0 - xi_point(1);
+    const real_t ep = 1.0 + xi_point(1);
+    const real_t tm = (1.0/16.0)*(1.0 - xi_point(3));
+    const real_t tp = (1.0/16.0)*(1.0 + xi_point(3));
+
+    const real_t xmem = xm*em;
+    const real_t xpem = xp*em;
+    const real_t xmep = xm*ep;
+    const real_t xpep = xp*ep;
+
+    partial_mu(0)  = -xmem*tm;
+    partial_mu(1)  = -xpem*tm;
+    partial_mu(2)  =  xpem*tm;
+    partial_mu(3)  =  xmem*tm;
+    partial_mu(4)  = -xmep*tm;
+    partial_mu(5)  = -xpep*tm;
+    partial_mu(6)  =  xpep*tm;
+    partial_mu(7)  =  xmep*tm;
+    partial_mu(8)  = -xmem*tp;
+    partial_mu(9)  = -xpem*tp;
+    partial_mu(10) =  xpem*tp;
+    partial_mu(11) =  xmem*tp;
+    partial_mu(12) = -xmep*tp;
+    partial_mu(13) = -xpep*tp;
+    partial_mu(14) =  xpep*tp;
+    partial_mu(15) =  xmep*tp;
 
 } // end partial Mu fuction
 
 
 // Partial derivative of shape functions with respect to Tau
+ELEMENTS_HOT
 void Tess16::partial_tau_basis(
-    ViewCArray <real_t> &partial_tau, 
+    ViewCArray <real_t> &partial_tau,
     const ViewCArray <real_t> &xi_point) {
 
-    auto ref_verts = ViewCArray<real_t> (ref_vert, num_verts, num_dim);
-
-    for (int this_vert = 0; this_vert < num_verts; this_vert++){  
-        partial_tau(this_vert) = 1.0/16.0
-            * (1.0 + xi_point(0)*ref_verts(this_vert, 0))
-            * (1.0 + xi_point(1)*ref_verts(this_vert, 1))
-            * (1.0 + xi_point(2)*ref_verts(this_vert, 2))
-            * (ref_verts(this_vert, 3));
-    } // end for this_vert   
+    // the tau derivative is the interior-cube product with the tau
+    // sign folded into a negation, as in the basis kernel
+    const real_t xm = 1.0 - xi_point(0);
+    const real_t xp = 1.0 + xi_point(0);
+    const real_t em = 1.0 - xi_point(1);
+    const real_t ep = 1.0 + xi_point(1);
+    const real_t mm = (1.0/16.0)*(1.0 - xi_point(2));
+    const real_t mp = (1.0/16.0)*(1.0 + xi_point(2));
+
+    const real_t cube[8] = {
+        xm*em*mm, xp*em*mm, xp*em*mp, xm*em*mp,
+        xm*ep*mm, xp*ep*mm, xp*ep*mp, xm*ep*mp};
+
+    #pragma omp simd
+    for (int this_vert = 0; this_vert < 8; this_vert++){
+        partial_tau(this_vert)     = -cube[this_vert];
+        partial_tau(this_vert + 8) =  cube[this_vert];
+    } // end for this_vert
 
 } // End partial tau function
 
+
+// evaluate the basis and all four partial derivatives in one pass: the
+// eight factor lanes (1 +- coordinate) are formed once up front - only
+// eight distinct values exist across the 16 vertices since every
+// ref_vert entry is +-1 - and each vertex selects its four lanes from
+// the compile-time sign pattern, so no (1 + xi*ref) multiply survives
+ELEMENTS_SIMD_DISPATCH
+void Tess16::basis_and_grads(
+    ViewCArray <real_t> &basis,
+    ViewCArray <real_t> &dphi,
+    const ViewCArray <real_t> &xi_point){
+
+    const real_t lanes_m[4] = {1.0 - xi_point(0), 1.0 - xi_point(1),
+                               1.0 - xi_point(2), 1.0 - xi_point(3)};
+    const real_t lanes_p[4] = {1.0 + xi_point(0), 1.0 + xi_point(1),
+                               1.0 + xi_point(2), 1.0 + xi_point(3)};
+
+    for (int this_vert = 0; this_vert < num_verts; this_vert++){
+
+        const real_t r0 = ref_vert[this_vert*num_dim + 0];
+        const real_t r1 = ref_vert[this_vert*num_dim + 1];
+        const real_t r2 = ref_vert[this_vert*num_dim + 2];
+        const real_t r3 = ref_vert[this_vert*num_dim + 3];
+
+        // lane selections fold to direct loads once the loop unrolls,
+        // because ref_vert is a compile-time constant
+        const real_t f0 = (r0 > 0.0) ? lanes_p[0] : lanes_m[0];
+        const real_t f1 = (r1 > 0.0) ? lanes_p[1] : lanes_m[1];
+        const real_t f2 = (r2 > 0.0) ? lanes_p[2] : lanes_m[2];
+        const real_t f3 = (r3 > 0.0) ? lanes_p[3] : lanes_m[3];
+
+        const real_t g01 = (1.0/16.0)*f0*f1;    // front pair, prescaled
+        const real_t g23 = f2*f3;               // back pair
+
+        basis(this_vert)   = g01*g23;
+        dphi(this_vert, 0) = (1.0/16.0)*r0*f1*g23;
+        dphi(this_vert, 1) = (1.0/16.0)*f0*r1*g23;
+        dphi(this_vert, 2) = r2*g01*f3;
+        dphi(this_vert, 3) = r3*g01*f2;
+    } // end for this_vert
+
+} // End fused basis and gradient function
+
+
+// raw-pointer overload writing derivative-major outputs: each derivative
+// occupies one contiguous run of num_verts values, so a downstream
+// Jacobian or assembly contraction over the vertices reads unit-stride
+// rows instead of the stride-4 columns of the (num_verts, num_dim) view
+ELEMENTS_SIMD_DISPATCH
+void Tess16::basis_and_grads(
+    real_t *ELEMENTS_RESTRICT basis,
+    real_t *ELEMENTS_RESTRICT dphi,
+    const real_t *ELEMENTS_RESTRICT xi_point){
+
+    const real_t lanes_m[4] = {1.0 - xi_point[0], 1.0 - xi_point[1],
+                               1.0 - xi_point[2], 1.0 - xi_point[3]};
+    const real_t lanes_p[4] = {1.0 + xi_point[0], 1.0 + xi_point[1],
+                               1.0 + xi_point[2], 1.0 + xi_point[3]};
+
+    for (int this_vert = 0; this_vert < num_verts; this_vert++){
+
+        const real_t r0 = ref_vert[this_vert*num_dim + 0];
+        const real_t r1 = ref_vert[this_vert*num_dim + 1];
+        const real_t r2 = ref_vert[this_vert*num_dim + 2];
+        const real_t r3 = ref_vert[this_vert*num_dim + 3];
+
+        const real_t f0 = (r0 > 0.0) ? lanes_p[0] : lanes_m[0];
+        const real_t f1 = (r1 > 0.0) ? lanes_p[1] : lanes_m[1];
+        const real_t f2 = (r2 > 0.0) ? lanes_p[2] : lanes_m[2];
+        const real_t f3 = (r3 > 0.0) ? lanes_p[3] : lanes_m[3];
+
+        const real_t g01 = (1.0/16.0)*f0*f1;    // front pair, prescaled
+        const real_t g23 = f2*f3;               // back pair
+
+        basis[this_vert]                = g01*g23;
+        dphi[0*num_verts + this_vert]   = (1.0/16.0)*r0*f1*g23;
+        dphi[1*num_verts + this_vert]   = (1.0/16.0)*f0*r1*g23;
+        dphi[2*num_verts + this_vert]   = r2*g01*f3;
+        dphi[3*num_verts + this_vert]   = r3*g01*f2;
+    } // end for this_vert
+
+} // End fused basis and gradient function (derivative major)
+
+
+// shared body for the batched Tess16 kernels; dim selects the
+// differentiated direction (0 xi, 1 eta, 2 mu, 3 tau) and -1 evaluates
+// the basis itself, so the five entry points compile from one
+// definition as in the Hex8 batch helpers
+template <int dim>
+static inline void tess16_eval_batch_fill(
+    real_t *ELEMENTS_RESTRICT out_tab,
+    const real_t *ELEMENTS_RESTRICT xi,
+    const real_t *ELEMENTS_RESTRICT eta,
+    const real_t *ELEMENTS_RESTRICT mu,
+    const real_t *ELEMENTS_RESTRICT tau,
+    const real_t *ELEMENTS_RESTRICT ref_vert,
+    const int num_verts,
+    const int num_dim,
+    const size_t num_points){
+
+    for (int vert_lid = 0; vert_lid < num_verts; vert_lid++){
+        const real_t xi_vert  = ref_vert[vert_lid*num_dim + 0];
+        const real_t eta_vert = ref_vert[vert_lid*num_dim + 1];
+        const real_t mu_vert  = ref_vert[vert_lid*num_dim + 2];
+        const real_t tau_vert = ref_vert[vert_lid*num_dim + 3];
+        real_t *out = out_tab + vert_lid*num_points;
+
+        #pragma omp simd
+        for (size_t i = 0; i < num_points; i++){
+            const real_t fx = (dim == 0) ? xi_vert  : 1.0 + xi[i]*xi_vert;
+            const real_t fe = (dim == 1) ? eta_vert : 1.0 + eta[i]*eta_vert;
+            const real_t fm = (dim == 2) ? mu_vert  : 1.0 + mu[i]*mu_vert;
+            const real_t ft = (dim == 3) ? tau_vert : 1.0 + tau[i]*tau_vert;
+            out[i] = (1.0/16.0)*fx*fe*fm*ft;
+        }
+    } // end for vert_lid
+
+} // end of tess16 batched eval body
+
+
+// calculate the value for the basis at each vertex for a batch of points
+// (vertex-major output, one contiguous run of points per vertex)
+ELEMENTS_SIMD_DISPATCH
+void Tess16::basis_batch(
+    real_t *basis_out,
+    const real_t *xi,
+    const real_t *eta,
+    const real_t *mu,
+    const real_t *tau,
+    const size_t num_points){
+
+    tess16_eval_batch_fill<-1>(basis_out, xi, eta, mu, tau,
+        ref_vert, num_verts, num_dim, num_points);
+
+}// end of tess16 batched basis functions
+
+
+// Partial derivative of shape functions with respect to Xi at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Tess16::partial_xi_basis_batch(
+    real_t *partial_xi_out,
+    const real_t *xi,
+    const real_t *eta,
+    const real_t *mu,
+    const real_t *tau,
+    const size_t num_points){
+
+    tess16_eval_batch_fill<0>(partial_xi_out, xi, eta, mu, tau,
+        ref_vert, num_verts, num_dim, num_points);
+
+}// end of tess16 batched partial xi functions
+
+
+// Partial derivative of shape functions with respect to Eta at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Tess16::partial_eta_basis_batch(
+    real_t *partial_eta_out,
+    const real_t *xi,
+    const real_t *eta,
+    const real_t *mu,
+    const real_t *tau,
+    const size_t num_points){
+
+    tess16_eval_batch_fill<1>(partial_eta_out, xi, eta, mu, tau,
+        ref_vert, num_verts, num_dim, num_points);
+
+}// end of tess16 batched partial eta functions
+
+
+// Partial derivative of shape functions with respect to Mu at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Tess16::partial_mu_basis_batch(
+    real_t *partial_mu_out,
+    const real_t *xi,
+    const real_t *eta,
+    const real_t *mu,
+    const real_t *tau,
+    const size_t num_points){
+
+    tess16_eval_batch_fill<2>(partial_mu_out, xi, eta, mu, tau,
+        ref_vert, num_verts, num_dim, num_points);
+
+}// end of tess16 batched partial mu functions
+
+
+// Partial derivative of shape functions with respect to Tau at a batch of
+// points (vertex-major output, as in the batched basis evaluation)
+ELEMENTS_SIMD_DISPATCH
+void Tess16::partial_tau_basis_batch(
+    real_t *partial_tau_out,
+    const real_t *xi,
+    const real_t *eta,
+    const real_t *mu,
+    const real_t *tau,
+    const size_t num_points){
+
+    tess16_eval_batch_fill<3>(partial_tau_out, xi, eta, mu, tau,
+        ref_vert, num_verts, num_dim, num_points);
+
+}// end of tess16 batched partial tau functions
+
+
+// map one set of reference points through a batch of elements; basis_tab is
+// the (num_verts, num_points) vertex-major table built by basis_batch, and
+// is shared by every element, so the per-element work is a dense update.
+// x_points is (num_elems, 4, num_points) and vertices (num_elems, num_verts, 4).
+// Each element's vertex block is loaded once and stays hot while all of its
+// points are accumulated; elements are independent, so the outer loop runs
+// one element per thread when built with OpenMP and the point loop vectorizes
+ELEMENTS_SIMD_DISPATCH
+void Tess16::physical_position_batch(
+    real_t *ELEMENTS_RESTRICT x_points,
+    const real_t *ELEMENTS_RESTRICT basis_tab,
+    const real_t *ELEMENTS_RESTRICT vertices,
+    const size_t num_elems,
+    const size_t num_points){
+
+    #pragma omp parallel for schedule(static)
+    for (size_t elem = 0; elem < num_elems; elem++){
+        real_t *out = x_points + elem*num_dim*num_points;
+        const real_t *verts = vertices + elem*num_verts*num_dim;
+
+        for (size_t i = 0; i < num_dim*num_points; i++){
+            out[i] = 0.0;
+        } // end for i
+
+        for (int vert_lid = 0; vert_lid < num_verts; vert_lid++){
+            const real_t vx = verts[vert_lid*num_dim + 0];
+            const real_t vy = verts[vert_lid*num_dim + 1];
+            const real_t vz = verts[vert_lid*num_dim + 2];
+            const real_t vt = verts[vert_lid*num_dim + 3];
+            const real_t *tab = basis_tab + vert_lid*num_points;
+
+            #pragma omp simd
+            for (size_t i = 0; i < num_points; i++){
+                const real_t shape = tab[i];
+                out[0*num_points + i] += vx*shape;
+                out[1*num_points + i] += vy*shape;
+                out[2*num_points + i] += vz*shape;
+                out[3*num_points + i] += vt*shape;
+            }
+        } // end for vert_lid
+    } // end for elem
+
+}// end of tess16 batched physical position function
+
 /* ----------------------------------------------------------------------
    choose the current 3D element type in the calculation
 ------------------------------------------------------------------------- */
@@ -236,12 +236,13 @@ namespace elements {
 
         public:
         
-        virtual int num_verts() = 0;
-        virtual int num_nodes() = 0;
-        virtual int num_basis() = 0;
+        // vertex/node/basis counts are compile-time constants of each concrete
+        // element type (static constexpr there), so they are not virtual here
         
         //list of local ids to basis functions needed to interpolate throughout a given element surface
-        RaggedRightArray<int> surface_to_dof_lid;
+        //(every surface of a given element type holds the same number of dofs,
+        // so the table is a plain rectangular array)
+        CArray<int> surface_to_dof_lid;
         int nsurfaces;
 
         // calculate a physical position in an element for a given xi,eta
@@ -278,12 +279,13 @@ namespace elements {
 
         public:
         
-        virtual int num_verts() = 0;
-        virtual int num_nodes() = 0;
-        virtual int num_basis() = 0;
+        // vertex/node/basis counts are compile-time constants of each concrete
+        // element type (static constexpr there), so they are not virtual here
 
         //list of local ids to basis functions needed to interpolate throughout a given element surface
-        RaggedRightArray<int> surface_to_dof_lid;
+        //(every surface of a given element type holds the same number of dofs,
+        // so the table is a plain rectangular array)
+        CArray<int> surface_to_dof_lid;
         int nsurfaces;
 
         // calculate a physical position in an element for a given xi,eta,mu
@@ -316,7 +318,7 @@ namespace elements {
         virtual inline int vert_node_map(const int vert_lid) = 0;
 
         // Reference vertices location
-        virtual real_t& ref_locs(const int vert_lid, const int dim) = 0;
+        virtual const real_t& ref_locs(const int vert_lid, const int dim) = 0;
 
     }; // end of 3D parent class
 
@@ -410,17 +412,33 @@ namespace elements {
             static const int num_nodes_ = 4;
             static const int num_basis_ = 4;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // reference vertex coordinates and the vertex-to-node map are
+            // compile-time constants so the basis kernels can fold the
+            // +-1 pattern instead of loading it from memory
+            alignas(64) static constexpr real_t ref_vert[num_verts_*num_dim_] =  // listed as {Xi, Eta}
+                {
+                -1.0, -1.0,// 0
+                 1.0, -1.0,// 1
+                 1.0,  1.0,// 2
+                -1.0,  1.0,// 3
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                2,
+                6,
+                8
+                };
 
         public:
 
             Quad4();
             ~Quad4();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
             
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -442,8 +460,76 @@ namespace elements {
 
             // Partial derivative of shape functions with respect to Eta
             void  partial_eta_basis(
-                ViewCArray <real_t> &partial_eta, 
-                const ViewCArray <real_t>  &xi_point); 
+                ViewCArray <real_t> &partial_eta,
+                const ViewCArray <real_t>  &xi_point);
+
+
+            // Raw-pointer overloads of the three routines above that write
+            // the evaluations into a contiguous buffer; the view-based
+            // versions delegate to these. Defined here in the header so
+            // callers with compile-time coordinates (Gauss points, corner
+            // checks) get the four-term expansion folded into literal
+            // coefficients
+            void basis(
+                real_t *basis,
+                const real_t xi,
+                const real_t eta){
+
+                #pragma GCC unroll 4
+                for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+                    basis[vert_lid] = (1.0/4.0)
+                        * (1.0 + xi*ref_vert[vert_lid*num_dim_ + 0])
+                        * (1.0 + eta*ref_vert[vert_lid*num_dim_ + 1]);
+                }
+            }
+
+            void partial_xi_basis(
+                real_t *partial_xi,
+                const real_t xi,
+                const real_t eta){
+
+                #pragma GCC unroll 4
+                for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+                    partial_xi[vert_lid] = (1.0/4.0)
+                        * (ref_vert[vert_lid*num_dim_ + 0])
+                        * (1.0 + eta*ref_vert[vert_lid*num_dim_ + 1]);
+                }
+            }
+
+            void partial_eta_basis(
+                real_t *partial_eta,
+                const real_t xi,
+                const real_t eta){
+
+                #pragma GCC unroll 4
+                for (int vert_lid = 0; vert_lid < num_verts_; vert_lid++){
+                    partial_eta[vert_lid] = (1.0/4.0)
+                        * (1.0 + xi*ref_vert[vert_lid*num_dim_ + 0])
+                        * (ref_vert[vert_lid*num_dim_ + 1]);
+                }
+            }
+
+            // Batched variants that evaluate at many points per call. The
+            // output is stored vertex-major: all evaluations of the basis
+            // function at vertex 0 first (one per point), then vertex 1, and
+            // so on, so the point loop is unit stride
+            void basis_batch(
+                real_t *basis_out,
+                const real_t *xi,
+                const real_t *eta,
+                const size_t num_points);
+
+            void partial_xi_basis_batch(
+                real_t *partial_xi_out,
+                const real_t *xi,
+                const real_t *eta,
+                const size_t num_points);
+
+            void partial_eta_basis_batch(
+                real_t *partial_eta_out,
+                const real_t *xi,
+                const real_t *eta,
+                const size_t num_points);
 
             // Map from vertex to node
             int vert_node_map( const int vert_lid);
@@ -483,17 +569,42 @@ namespace elements {
             static const int num_nodes_ = 8;
             static const int num_basis_ = 8;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // compile-time reference vertex coordinates and vertex-to-node
+            // map (see Quad4)
+            alignas(64) static constexpr real_t ref_vert[num_verts_*num_dim_] =  // listed as {Xi, Eta}
+                {
+                // corner nodes
+                -1.0, -1.0,// 0
+                 1.0, -1.0,// 1
+                 1.0,  1.0,// 2
+                -1.0,  1.0,// 3
+                // midline nodes
+                 0.0, -1.0,// 4
+                 1.0,  0.0,// 5
+                 0.0,  1.0,// 6
+                -1.0,  0.0,// 7
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                4,
+                24,
+                20,
+                2,
+                14,
+                23,
+                10
+                };
 
         public:
         
             Quad8();
             ~Quad8();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
 
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -518,6 +629,33 @@ namespace elements {
                 ViewCArray <real_t> &partial_eta, 
                 const ViewCArray <real_t>  &xi_point);
 
+            // Raw-pointer overloads of the three routines above that write
+            // the evaluations into a contiguous buffer; the view-based
+            // versions delegate to these
+            void basis(
+                real_t *basis,
+                const real_t xi,
+                const real_t eta);
+
+            void partial_xi_basis(
+                real_t *partial_xi,
+                const real_t xi,
+                const real_t eta);
+
+            void partial_eta_basis(
+                real_t *partial_eta,
+                const real_t xi,
+                const real_t eta);
+
+            // Batched variant that evaluates the basis at many points per
+            // call, with the same vertex-major output layout as
+            // Quad4::basis_batch
+            void basis_batch(
+                real_t *basis_out,
+                const real_t *xi,
+                const real_t *eta,
+                const size_t num_points);
+
             // Map from vertex to node
             int vert_node_map( const int vert_lid);
     
@@ -556,17 +694,51 @@ namespace elements {
             static const int num_nodes_ = 12;
             static const int num_basis_ = 12;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // compile-time reference vertex coordinates and vertex-to-node
+            // map (see Quad4)
+            alignas(64) static constexpr real_t ref_vert[num_verts_*num_dim_] =  // listed as {Xi, Eta}
+                {
+                // corner nodes
+                -1.0, -1.0,// 0
+                 1.0, -1.0,// 1
+                 1.0,  1.0,// 2
+                -1.0,  1.0,// 3
+                // Eta +- 1./3.
+                -1./3., -1.0,// 4
+                 1./3., -1.0,// 5
+                 1./3.,  1.0,// 6
+                -1./3.,  1.0,// 7
+                // Xi +- 1./3.
+                -1.0, -1./3.,// 8
+                 1.0, -1./3.,// 9
+                 1.0,  1./3.,// 10
+                -1.0,  1./3.,// 11
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                6,
+                48,
+                42,
+                2,
+                4,
+                46,
+                44,
+                14,
+                20,
+                34,
+                28
+                };
 
         public:
         
             Quad12();
             ~Quad12();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
 
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -591,6 +763,24 @@ namespace elements {
                 ViewCArray <real_t> &partial_eta, 
                 const ViewCArray <real_t>  &xi_point);
 
+            // Raw-pointer overloads of the three routines above that write
+            // the evaluations into a contiguous buffer; the view-based
+            // versions delegate to these
+            void basis(
+                real_t *basis,
+                const real_t xi,
+                const real_t eta);
+
+            void partial_xi_basis(
+                real_t *partial_xi,
+                const real_t xi,
+                const real_t eta);
+
+            void partial_eta_basis(
+                real_t *partial_eta,
+                const real_t xi,
+                const real_t eta);
+
             // Map from vertex to node
             int vert_node_map( const int vert_lid);
 
@@ -634,6 +824,9 @@ namespace elements {
             int num_basis;
             int num_verts;
 
+            QuadN();
+            ~QuadN();
+
             // calculates the basis values and derivatives in 1D
             // used in the basis_partials functiosn to build the 3D element
             void lagrange_1D(
@@ -659,12 +852,85 @@ namespace elements {
                 ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
                 ViewCArray <real_t> &val_1d,          // Interpolant Value in 1D
                 ViewCArray <real_t> &DVal_1d,         // Derivateive of basis in 1D
-                ViewCArray <real_t> &val_2d,          // for holding the interpolant in each direction
-                ViewCArray <real_t> &DVal_2d,         // for holding the derivatives in each direction
                 ViewCArray <real_t> &lag_basis_2d,    // 2D basis values 
-                ViewCArray <real_t> &lag_partial,     // Partial of basis 
+                ViewCArray <real_t> &lag_partial,     // Partial of basis, (2, num nodes): all
+                                                        // xi partials first, then all eta partials
+                const ViewCArray <real_t> &xi_point,  // point of interest
+                const int &orderN);                     // Element order
+
+            // single-precision variant of basis_partials for visualization
+            // consumers: the 1D evaluation stays in double and only the
+            // stored tables drop to float
+            void basis_partials_f32 (
+                ViewCArray <float> &lag_nodes,        // Nodes of Lagrange elements (to be filled in)
+                ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+                ViewCArray <float> &lag_basis_2d,     // 2D basis values
+                ViewCArray <float> &lag_partial,      // Partial of basis, (2, num nodes): all
+                                                        // xi partials first, then all eta partials
                 const ViewCArray <real_t> &xi_point,  // point of interest
                 const int &orderN);                     // Element order
+
+            // evaluates the basis and partials at a whole set of points in
+            // one call; outputs are point-major with the same per-point
+            // blocks as basis_partials, and the reference-node table is not
+            // produced since it does not depend on the points
+            void basis_partials_batch (
+                ViewCArray <real_t> &lag_basis_2d,    // (num points, num nodes) basis values
+                ViewCArray <real_t> &lag_partial,     // (num points, 2, num nodes): per point,
+                                                        // all xi partials then all eta partials
+                ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+                const ViewCArray <real_t> &xi_points, // (num points, 2) points of interest
+                const int &num_points,                // number of evaluation points
+                const int &orderN);                     // Element order
+
+            // tabulates the basis and partials at a fixed set of points so
+            // assembly loops over a quadrature rule can fetch stored blocks
+            // instead of re-evaluating
+            void precompute_basis_partials (
+                ViewCArray <real_t> &nodes_1d,        // Nodal spacing in 1D, any spacing is accepted
+                const ViewCArray <real_t> &xi_points, // (num points, 2) points to tabulate
+                const int &num_points,                // number of tabulated points
+                const int &orderN);                     // Element order
+
+            // fetches the tabulated blocks for one point of the rule passed
+            // to precompute_basis_partials
+            void basis_partials_precomputed (
+                ViewCArray <real_t> &lag_basis_2d,    // (num nodes) basis values
+                ViewCArray <real_t> &lag_partial,     // (2, num nodes): all xi partials
+                                                        // first, then all eta partials
+                const int &q_id) const;                 // index of the tabulated point
+
+        private:
+
+            // barycentric weights for the 1D interpolation, cached keyed on
+            // the element order so repeated lagrange_1D calls at the same
+            // order skip the O(N^2) weight computation
+            real_t *bary_w;
+            int bary_order;
+
+            // reference-node table for basis_partials, cached keyed on the
+            // element order and the 1D node array it was built from
+            real_t *lag_nodes_cache;
+            const real_t *lag_nodes_src;
+            int lag_nodes_order;
+
+            // basis/partial table built by precompute_basis_partials: the
+            // basis blocks for all tabulated points, then the partial blocks
+            real_t *quad_table;
+            int quad_table_points;
+            int quad_table_tot;
+
+            // rebuilds bary_w when the order changes; not thread safe, so
+            // multi-threaded evaluation must warm the cache up front
+            void update_bary_cache(
+                const real_t *nodes,
+                const int orderN);
+
+            // rebuilds lag_nodes_cache when the order or node array changes
+            void update_lag_nodes_cache(
+                const ViewCArray <real_t> &nodes_1d,
+                const int orderN,
+                const int N);
     };
 
 
@@ -716,17 +982,47 @@ class Hex8: public Element3D {
             static const int num_nodes_ = 8;
             static const int num_basis_ = 8;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // compile-time reference vertex coordinates, stored as one
+            // contiguous array per dimension (structure of arrays) so the
+            // basis loops read each column with a single contiguous load
+            alignas(64) static constexpr real_t ref_vert_x[num_verts_] =
+                {
+                -1.0, +1.0, -1.0, +1.0,
+                -1.0, +1.0, -1.0, +1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_y[num_verts_] =
+                {
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_z[num_verts_] =
+                {
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                2,
+                6,
+                8,
+                18,
+                20,
+                24,
+                24
+                };;
 
         public:
         
             Hex8();
             ~Hex8();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
 
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -756,10 +1052,147 @@ class Hex8: public Element3D {
                 ViewCArray <real_t> &partial_mu, 
                 const ViewCArray <real_t>  &xi_point);
 
-            // Map from vertex to node
-            inline int vert_node_map(const int vert_lid);
+            // Raw-pointer overloads of the four routines above that write
+            // the evaluations into a contiguous buffer; the view-based
+            // versions delegate to these
+            void basis(
+                real_t *basis,
+                const real_t xi,
+                const real_t eta,
+                const real_t mu);
+
+            void partial_xi_basis(
+                real_t *partial_xi,
+                const real_t xi,
+                const real_t eta,
+                const real_t mu);
+
+            void partial_eta_basis(
+                real_t *partial_eta,
+                const real_t xi,
+                const real_t eta,
+                const real_t mu);
+
+            void partial_mu_basis(
+                real_t *partial_mu,
+                const real_t xi,
+                const real_t eta,
+                const real_t mu);
+
+            // all three partial derivatives in one pass (dphi is
+            // (num_verts, 3)); the shared per-direction factors are
+            // computed once instead of twice per direction
+            void partial_basis_all(
+                ViewCArray <real_t> &dphi,
+                const ViewCArray <real_t> &xi_point);
 
-            real_t& ref_locs(const int vert_lid, const int dim);
+            void partial_basis_all(
+                real_t *dphi,
+                const real_t xi,
+                const real_t eta,
+                const real_t mu);
+
+            // Batched variants that evaluate at many points per call, with
+            // the same vertex-major output layout as Quad4::basis_batch; the
+            // point coordinates come in as one contiguous array per
+            // dimension so the point loop is unit stride
+            void basis_batch(
+                real_t *basis_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
+            void partial_xi_basis_batch(
+                real_t *partial_xi_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
+            void partial_eta_basis_batch(
+                real_t *partial_eta_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
+            void partial_mu_basis_batch(
+                real_t *partial_mu_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
+            // map one set of reference points through a batch of elements
+            // using a basis table from basis_batch; elements are independent,
+            // so the outer loop parallelizes and the point loop vectorizes
+            void physical_position_batch(
+                real_t *x_points,
+                const real_t *basis_tab,
+                const real_t *vertices,
+                const size_t num_elems,
+                const size_t num_points);
+
+            // Jacobians of the reference-to-physical map for a batch of
+            // elements at a shared set of points; the three derivative
+            // tables come from the partial_*_basis_batch routines and are
+            // reused across every element, and each element's vertex block
+            // is loaded once and stays hot while all points are processed.
+            // jac is (num_elems, 3, 3, num_points), physical dim major
+            void jacobian_batch(
+                real_t *jac,
+                const real_t *dxi_tab,
+                const real_t *deta_tab,
+                const real_t *dmu_tab,
+                const real_t *vertices,
+                const size_t num_elems,
+                const size_t num_points);
+
+            // single precision variants of the batched kernels for
+            // approximation tolerant paths (visualization, Newton initial
+            // guesses, point search); float halves the bytes moved and
+            // doubles the SIMD lane count
+            void basis_batch_f32(
+                float *basis_out,
+                const float *xi,
+                const float *eta,
+                const float *mu,
+                const size_t num_points);
+
+            void partial_xi_basis_batch_f32(
+                float *partial_xi_out,
+                const float *xi,
+                const float *eta,
+                const float *mu,
+                const size_t num_points);
+
+            void partial_eta_basis_batch_f32(
+                float *partial_eta_out,
+                const float *xi,
+                const float *eta,
+                const float *mu,
+                const size_t num_points);
+
+            void partial_mu_basis_batch_f32(
+                float *partial_mu_out,
+                const float *xi,
+                const float *eta,
+                const float *mu,
+                const size_t num_points);
+
+            void physical_position_batch_f32(
+                float *x_points,
+                const float *basis_tab,
+                const float *vertices,
+                const size_t num_elems,
+                const size_t num_points);
+
+            // Map from vertex to node; defined in class so concrete-type
+            // call sites inline to a single constant array load
+            int vert_node_map(const int vert_lid) noexcept { return vert_to_node[vert_lid]; }
+
+            const real_t& ref_locs(const int vert_lid, const int dim) noexcept;
 
     }; // end of hex 8 class
 
@@ -797,17 +1230,68 @@ class Hex8: public Element3D {
             static const int num_nodes_ = 20;
             static const int num_basis_ = 20;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // compile-time reference vertex coordinates, stored as one
+            // contiguous array per dimension (structure of arrays) so the
+            // basis loops read each column with a single contiguous load
+            alignas(64) static constexpr real_t ref_vert_x[num_verts_] =
+                {
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0,
+                 0.0, +1.0,  0.0, -1.0,
+                 0.0, +1.0,  0.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_y[num_verts_] =
+                {
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0,  0.0, +1.0,  0.0,
+                -1.0,  0.0, +1.0,  0.0,
+                -1.0, -1.0, +1.0, +1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_z[num_verts_] =
+                {
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                 0.0,  0.0,  0.0,  0.0
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                4,
+                24,
+                20,
+                100,
+                104,
+                124,
+                120,
+                2,
+                14,
+                22,
+                10,
+                102,
+                114,
+                122,
+                110,
+                50,
+                54,
+                74,
+                70
+                };;
 
         public:
         
             Hex20();
             ~Hex20();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
 
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -837,10 +1321,34 @@ class Hex8: public Element3D {
                 ViewCArray <real_t> &partial_mu, 
                 const ViewCArray <real_t>  &xi_point);
 
-            // Map from vertex to node
-            inline int vert_node_map(const int vert_lid);
+            // all three partial derivatives in one pass (dphi is
+            // (num_verts, 3)); the shared per-direction factors are
+            // computed once instead of twice per direction
+            void partial_basis_all(
+                ViewCArray <real_t> &dphi,
+                const ViewCArray <real_t> &xi_point);
+
+            // tabulate the basis at a fixed set of quadrature points; the
+            // rule is known at mesh-init time and shared by every geometric
+            // element, so the table is built once and reused mesh wide
+            void basis_precompute(
+                ViewCArray <real_t> &basis_tab,
+                const ViewCArray <real_t> &xi_points,
+                const int num_points);
+
+            // physical position at quadrature point q_id from a table built
+            // by basis_precompute; the hot path is then a single dot product
+            void physical_position_precomputed(
+                ViewCArray <real_t> &x_point,
+                const ViewCArray <real_t> &basis_tab,
+                const int q_id,
+                const ViewCArray <real_t> &vertices) const;
 
-            real_t& ref_locs(const int vert_lid, const int dim);
+            // Map from vertex to node; defined in class so concrete-type
+            // call sites inline to a single constant array load
+            int vert_node_map(const int vert_lid) noexcept { return vert_to_node[vert_lid]; }
+
+            const real_t& ref_locs(const int vert_lid, const int dim) noexcept;
 
     }; // end of hex20 class
 
@@ -886,17 +1394,89 @@ class Hex8: public Element3D {
             static const int num_nodes_ = 32;
             static const int num_basis_ = 32;
 
-            static real_t ref_vert[num_verts_*num_dim_];  // listed as {Xi, Eta, Mu}
-            static const int vert_to_node[num_verts_];
+            // compile-time reference vertex coordinates, stored as one
+            // contiguous array per dimension (structure of arrays) so the
+            // basis loops read each column with a single contiguous load
+            alignas(64) static constexpr real_t ref_vert_x[num_verts_] =
+                {
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0/3.0, +1.0/3.0, +1.0/3.0, -1.0/3.0,
+                -1.0/3.0, +1.0/3.0, +1.0/3.0, -1.0/3.0,
+                -1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_y[num_verts_] =
+                {
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0/3.0, -1.0/3.0, +1.0/3.0, +1.0/3.0,
+                -1.0/3.0, -1.0/3.0, +1.0/3.0, +1.0/3.0,
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0
+                };
+
+            alignas(64) static constexpr real_t ref_vert_z[num_verts_] =
+                {
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                -1.0/3.0, -1.0/3.0, -1.0/3.0, -1.0/3.0,
+                +1.0/3.0, +1.0/3.0, +1.0/3.0, +1.0/3.0
+                };
+
+            alignas(64) static constexpr int vert_to_node[num_verts_] = 
+                {
+                0,
+                6,
+                48,
+                42,
+                294,
+                300,
+                342,
+                336,
+                14,
+                20,
+                32,
+                28,
+                308,
+                314,
+                328,
+                322,
+                2,
+                4,
+                46,
+                44,
+                296,
+                298,
+                340,
+                338,
+                98,
+                104,
+                146,
+                140,
+                196,
+                202,
+                244,
+                298
+                };;
 
         public:
         
             Hex32();
             ~Hex32();
 
-            int num_verts();
-            int num_nodes();
-            int num_basis();
+            static constexpr int num_verts() noexcept { return num_verts_; }
+            static constexpr int num_nodes() noexcept { return num_nodes_; }
+            static constexpr int num_basis() noexcept { return num_basis_; }
 
             // calculate a physical position in an element for a given xi,eta
             void physical_position(
@@ -926,10 +1506,54 @@ class Hex8: public Element3D {
                 ViewCArray <real_t> &partial_mu, 
                 const ViewCArray <real_t>  &xi_point);
 
-            // Map from vertex to node
-            int vert_node_map(const int vert_lid);
+            // all three partial derivatives in one pass (dphi is
+            // (num_verts, 3)); the shared per-direction factors are
+            // computed once instead of twice per direction
+            void partial_basis_all(
+                ViewCArray <real_t> &dphi,
+                const ViewCArray <real_t> &xi_point);
+
+            // basis and all three partial derivatives in one pass for
+            // assembly callers that always need the four together; the
+            // trilinear factors, bubble terms, and the corner radial
+            // polynomial are computed once and feed every output
+            void basis_and_grads(
+                ViewCArray <real_t> &basis,
+                ViewCArray <real_t> &dphi,
+                const ViewCArray <real_t> &xi_point);
 
-            real_t& ref_locs(const int vert_lid, const int dim);
+            // calculate the value for the basis at each vertex for a batch
+            // of points (vertex-major output, one contiguous run of points
+            // per vertex, as in Hex8::basis_batch); vectorizes across
+            // points, so the lanes stay full regardless of the vertex count
+            void basis_batch(
+                real_t *basis_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
+            // tabulate the basis at a fixed set of quadrature points; the
+            // rule is known at mesh-init time and shared by every geometric
+            // element, so the table is built once and reused mesh wide
+            void basis_precompute(
+                ViewCArray <real_t> &basis_tab,
+                const ViewCArray <real_t> &xi_points,
+                const int num_points);
+
+            // physical position at quadrature point q_id from a table built
+            // by basis_precompute; the hot path is then a single dot product
+            void physical_position_precomputed(
+                ViewCArray <real_t> &x_point,
+                const ViewCArray <real_t> &basis_tab,
+                const int q_id,
+                const ViewCArray <real_t> &vertices) const;
+
+            // Map from vertex to node; defined in class so concrete-type
+            // call sites inline to a single constant array load
+            int vert_node_map(const int vert_lid) noexcept { return vert_to_node[vert_lid]; }
+
+            const real_t& ref_locs(const int vert_lid, const int dim) noexcept;
 
     }; // end of hex32 class
 
@@ -983,6 +1607,10 @@ class Hex8: public Element3D {
             CArray <real_t> HexN_Verts_1d_;
             CArray <real_t> HexN_Verts_;
 
+            // Reciprocal barycentric weights 1/prod_{j!=i}(x_i - x_j) for
+            // the 1D Lagrange basis, cached when the nodes are created
+            CArray <real_t> HexN_Bary_Wts_1d_;
+
             CArray <size_t> Vert_Node_map_;
             
             int order_;
@@ -1024,22 +1652,293 @@ class Hex8: public Element3D {
 
             // calculate the partial of the basis w.r.t mu at a given point
             void partial_mu_basis(
-                CArray <real_t> &partial_mu, 
+                CArray <real_t> &partial_mu,
                 CArray <real_t> &point);
 
+            // evaluate the basis and all three partials in one pass,
+            // sharing the six 1D evaluations across the four outputs
+            void basis_and_grads(
+                CArray <real_t> &basis,
+                CArray <real_t> &partial_xi,
+                CArray <real_t> &partial_eta,
+                CArray <real_t> &partial_mu,
+                CArray <real_t> &point);
+
+            // single-precision basis evaluation for accuracy-tolerant
+            // consumers (rendering, first-pass residuals): the 1D
+            // Lagrange values are still computed in double and the
+            // tensor product runs in float, so roughly seven decimal
+            // digits survive - solver-critical paths should stay with
+            // the double-precision basis
+            void basis_f32(
+                float *basis,
+                const real_t *point);
+
+            // raw-pointer overload; each output holds num_verts() values
+            void basis_and_grads(
+                real_t *basis,
+                real_t *partial_xi,
+                real_t *partial_eta,
+                real_t *partial_mu,
+                const real_t *point);
+
+            // evaluate the fused basis and gradients at a batch of
+            // points in parallel; outputs are point-major tables of
+            // shape (num_points, num_verts()) so each evaluation
+            // writes one contiguous block, and the inputs are the
+            // xi/eta/mu coordinate arrays of length num_points
+            void basis_and_grads_batch(
+                real_t *basis_tab,
+                real_t *partial_xi_tab,
+                real_t *partial_eta_tab,
+                real_t *partial_mu_tab,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const size_t num_points);
+
             void lagrange_basis_1D(
                 CArray <real_t> &interp,    // interpolant
                 const real_t &x_point);     // point of interest in element
-            
+
             void lagrange_derivative_1D(
                 CArray <real_t> &partials,  //derivative
                 const real_t &x_point);     // point of interest in element
 
+            // raw-pointer overloads used by the basis routines; they
+            // evaluate into caller-supplied storage without allocating
+            void lagrange_basis_1D(
+                real_t *interp,             // interpolant
+                const real_t x_point);      // point of interest in element
+
+            void lagrange_derivative_1D(
+                real_t *partials,           // derivative
+                const real_t x_point);      // point of interest in element
+
             void create_lobatto_nodes(int element_order);
 
     };
 
 
+    /*
+     Compile-time specialization of the HexN basis evaluation for a
+     fixed polynomial order.  All sizes are template constants, so the
+     scratch arrays live on the stack, the loop bounds are known to the
+     compiler, and the tensor-product loops unroll and vectorize.  Use
+     this in hot paths where the element order is fixed at compile time;
+     the run-time HexN class remains for order-agnostic callers.
+
+     Vertex positions and basis values match HexN at the same order
+     (the vertices are the every-other nodes of the order 2N Lobatto
+     grid).  Only orders >= 1 are supported.
+    */
+
+    template <int elem_order>
+    class HexN_T {
+
+        public:
+
+            static constexpr int num_verts_1d_ = elem_order + 1;
+            static constexpr int num_verts_ = num_verts_1d_*num_verts_1d_*num_verts_1d_;
+
+        private:
+
+            real_t verts_1d_[num_verts_1d_];
+
+            // Reciprocal barycentric weights, as in HexN_Bary_Wts_1d_
+            real_t bary_wts_[num_verts_1d_];
+
+        public:
+
+            HexN_T(){
+
+                const int num_nodes_1d = 2*elem_order + 1;
+
+                auto nodes_1d = CArray <real_t> (num_nodes_1d);
+                lobatto_nodes_1D(nodes_1d, num_nodes_1d);
+
+                for(int i = 0; i < num_verts_1d_; i++){
+                    verts_1d_[i] = nodes_1d(2*i);
+                }
+
+                for(int vert_i = 0; vert_i < num_verts_1d_; vert_i++){
+
+                    real_t denominator = 1.0;
+
+                    for(int vert_j = 0; vert_j < num_verts_1d_; vert_j++){
+                        if (vert_j != vert_i){
+                            denominator = denominator*(verts_1d_[vert_i] - verts_1d_[vert_j]);
+                        }// end if
+                    }
+
+                    bary_wts_[vert_i] = 1.0/denominator;
+                }
+            }
+
+            constexpr int num_verts() const { return num_verts_; }
+
+            constexpr int vert_rid(const int i, const int j, const int k) const {
+                return i + j*num_verts_1d_ + k*num_verts_1d_*num_verts_1d_;
+            }
+
+            const real_t &vert_coords_1d(const int i) const { return verts_1d_[i]; }
+
+            // 1D basis values by the branch-free prefix/suffix form
+            // used in HexN::lagrange_basis_1D, on stack scratch
+            void lagrange_basis_1D(real_t * interp,
+                                   const real_t x_point) const {
+
+                real_t diff[num_verts_1d_];
+                real_t pre[num_verts_1d_ + 1];
+                real_t suf[num_verts_1d_ + 1];
+
+                for(int j = 0; j < num_verts_1d_; j++){
+                    diff[j] = x_point - verts_1d_[j];
+                }
+
+                pre[0] = 1.0;
+                for(int j = 0; j < num_verts_1d_; j++){
+                    pre[j + 1] = pre[j]*diff[j];
+                }
+
+                suf[num_verts_1d_] = 1.0;
+                for(int j = num_verts_1d_ - 1; j >= 0; j--){
+                    suf[j] = suf[j + 1]*diff[j];
+                }
+
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
+                    interp[i] = pre[i]*suf[i + 1]*bary_wts_[i];
+                }
+            }
+
+            // 1D derivatives by the product-rule scans used in
+            // HexN::lagrange_derivative_1D
+            void lagrange_derivative_1D(real_t * deriv,
+                                        const real_t x_point) const {
+
+                real_t diff[num_verts_1d_];
+                real_t pre[num_verts_1d_ + 1];
+                real_t suf[num_verts_1d_ + 1];
+                real_t dpre[num_verts_1d_ + 1];
+                real_t dsuf[num_verts_1d_ + 1];
+
+                for(int j = 0; j < num_verts_1d_; j++){
+                    diff[j] = x_point - verts_1d_[j];
+                }
+
+                pre[0]  = 1.0;
+                dpre[0] = 0.0;
+                for(int j = 0; j < num_verts_1d_; j++){
+                    dpre[j + 1] = dpre[j]*diff[j] + pre[j];
+                    pre[j + 1]  = pre[j]*diff[j];
+                }
+
+                suf[num_verts_1d_]  = 1.0;
+                dsuf[num_verts_1d_] = 0.0;
+                for(int j = num_verts_1d_ - 1; j >= 0; j--){
+                    dsuf[j] = dsuf[j + 1]*diff[j] + suf[j + 1];
+                    suf[j]  = suf[j + 1]*diff[j];
+                }
+
+                #pragma omp simd
+                for(int i = 0; i < num_verts_1d_; i++){
+                    deriv[i] = bary_wts_[i]
+                               *(dpre[i]*suf[i + 1] + pre[i]*dsuf[i + 1]);
+                }
+            }
+
+            // Evaluate all basis functions at a point; output is
+            // indexed by vert_rid(i,j,k), as in HexN::basis
+            void basis(real_t * basis,
+                       const real_t * point) const {
+
+                real_t val_x[num_verts_1d_];
+                real_t val_y[num_verts_1d_];
+                real_t val_z[num_verts_1d_];
+
+                lagrange_basis_1D(val_x, point[0]);
+                lagrange_basis_1D(val_y, point[1]);
+                lagrange_basis_1D(val_z, point[2]);
+
+                tensor_product(basis, val_x, val_y, val_z);
+            }
+
+            void partial_xi_basis(real_t * partial_xi,
+                                  const real_t * point) const {
+
+                real_t val_x[num_verts_1d_];
+                real_t val_y[num_verts_1d_];
+                real_t val_z[num_verts_1d_];
+
+                lagrange_derivative_1D(val_x, point[0]);
+                lagrange_basis_1D(val_y, point[1]);
+                lagrange_basis_1D(val_z, point[2]);
+
+                tensor_product(partial_xi, val_x, val_y, val_z);
+            }
+
+            void partial_eta_basis(real_t * partial_eta,
+                                   const real_t * point) const {
+
+                real_t val_x[num_verts_1d_];
+                real_t val_y[num_verts_1d_];
+                real_t val_z[num_verts_1d_];
+
+                lagrange_basis_1D(val_x, point[0]);
+                lagrange_derivative_1D(val_y, point[1]);
+                lagrange_basis_1D(val_z, point[2]);
+
+                tensor_product(partial_eta, val_x, val_y, val_z);
+            }
+
+            void partial_mu_basis(real_t * partial_mu,
+                                  const real_t * point) const {
+
+                real_t val_x[num_verts_1d_];
+                real_t val_y[num_verts_1d_];
+                real_t val_z[num_verts_1d_];
+
+                lagrange_basis_1D(val_x, point[0]);
+                lagrange_basis_1D(val_y, point[1]);
+                lagrange_derivative_1D(val_z, point[2]);
+
+                tensor_product(partial_mu, val_x, val_y, val_z);
+            }
+
+        private:
+
+            // Sum-factorized rank-1 tensor product, as in HexN::basis:
+            // build the xy plane once, then scale it by each z value
+            void tensor_product(real_t * out,
+                                const real_t * val_x,
+                                const real_t * val_y,
+                                const real_t * val_z) const {
+
+                real_t val_xy[num_verts_1d_*num_verts_1d_];
+
+                for(int j = 0; j < num_verts_1d_; j++){
+                    #pragma omp simd
+                    for(int i = 0; i < num_verts_1d_; i++){
+                        val_xy[j*num_verts_1d_ + i] = val_x[i]*val_y[j];
+                    }
+                }
+
+                for(int k = 0; k < num_verts_1d_; k++){
+
+                    real_t vz = val_z[k];
+                    int plane = k*num_verts_1d_*num_verts_1d_;
+
+                    #pragma omp simd
+                    for(int ij = 0; ij < num_verts_1d_*num_verts_1d_; ij++){
+                        out[plane + ij] = val_xy[ij]*vz;
+                    }
+                }
+            }
+
+    };
+
+
 
     /*
     ==========================
@@ -1099,7 +1998,30 @@ class Hex8: public Element3D {
             const static int num_basis = 16;
 
         protected:
-            static real_t ref_vert[num_verts*num_dim];  // listed as {Xi, Eta, Mu, Tau}
+            // compile-time reference vertex coordinates (see Quad4)
+            alignas(64) static constexpr real_t ref_vert[num_verts*num_dim] =  // listed as {Xi, Eta, Mu, Tau}
+                {
+                // Interior cube bottom
+                -1.0, -1.0, -1.0, -1.0,
+                +1.0, -1.0, -1.0, -1.0,
+                +1.0, -1.0, +1.0, -1.0,
+                -1.0, -1.0, +1.0, -1.0,
+                // Interior cube top
+                -1.0, +1.0, -1.0, -1.0,
+                +1.0, +1.0, -1.0, -1.0,
+                +1.0, +1.0, +1.0, -1.0,
+                -1.0, +1.0, +1.0, -1.0,
+                // Exterior cube bottom
+                -1.0, -1.0, -1.0, +1.0,
+                +1.0, -1.0, -1.0, +1.0,
+                +1.0, -1.0, +1.0, +1.0,
+                -1.0, -1.0, +1.0, +1.0,
+                // Exterior cube top
+                -1.0, +1.0, -1.0, +1.0,
+                +1.0, +1.0, -1.0, +1.0,
+                +1.0, +1.0, +1.0, +1.0,
+                -1.0, +1.0, +1.0, +1.0,
+                };
 
 
         public:
@@ -1109,7 +2031,15 @@ class Hex8: public Element3D {
                 ViewCArray <real_t> &x_point,
                 const ViewCArray <real_t> &xi_point,
                 const ViewCArray <real_t> &vertices);
-            
+
+            // SoA overload: vertices_soa holds num_dim contiguous runs of
+            // num_verts coordinates (vertices_soa[dim*num_verts + vert]),
+            // so each dimension reduces over a unit-stride row
+            void physical_position(
+                real_t *x_point,
+                const real_t *xi_point,
+                const real_t *vertices_soa);
+
             // calculate the value for the basis at each node for a given xi,eta,mu,tau
             void basis(
                 ViewCArray <real_t>  &basis,
@@ -1132,8 +2062,79 @@ class Hex8: public Element3D {
 
             // Partial derivative of shape functions with respect to Tau
             void partial_tau_basis(
-                ViewCArray <real_t> &partial_tau, 
-                const ViewCArray <real_t> &xi_point);                                          
+                ViewCArray <real_t> &partial_tau,
+                const ViewCArray <real_t> &xi_point);
+
+            // evaluate the basis and all four partials in one pass;
+            // dphi has shape (num_verts, num_dim) and the shared
+            // factor products are formed once per vertex
+            void basis_and_grads(
+                ViewCArray <real_t> &basis,
+                ViewCArray <real_t> &dphi,
+                const ViewCArray <real_t> &xi_point);
+
+            // raw-pointer overload with derivative-major outputs: dphi
+            // holds num_dim contiguous runs of num_verts values
+            // (dphi[dim*num_verts + vert]), so an assembly contraction
+            // over the vertices sweeps unit-stride rows per derivative
+            void basis_and_grads(
+                real_t *basis,
+                real_t *dphi,
+                const real_t *xi_point);
+
+            // batched evaluations over SoA reference coordinates
+            // (vertex-major output, one contiguous run of points per
+            // vertex, as in the Hex8 batch kernels)
+            void basis_batch(
+                real_t *basis_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const real_t *tau,
+                const size_t num_points);
+
+            void partial_xi_basis_batch(
+                real_t *partial_xi_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const real_t *tau,
+                const size_t num_points);
+
+            void partial_eta_basis_batch(
+                real_t *partial_eta_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const real_t *tau,
+                const size_t num_points);
+
+            void partial_mu_basis_batch(
+                real_t *partial_mu_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const real_t *tau,
+                const size_t num_points);
+
+            void partial_tau_basis_batch(
+                real_t *partial_tau_out,
+                const real_t *xi,
+                const real_t *eta,
+                const real_t *mu,
+                const real_t *tau,
+                const size_t num_points);
+
+            // map one set of reference points through a batch of elements
+            // using a basis table from basis_batch, as in the Hex8 batch
+            // kernels; x_points is (num_elems, num_dim, num_points) and
+            // vertices (num_elems, num_verts, num_dim)
+            void physical_position_batch(
+                real_t *x_points,
+                const real_t *basis_tab,
+                const real_t *vertices,
+                const size_t num_elems,
+                const size_t num_points);
     }; // End of Tess16 Element Class
 
 /* Add enumerated list of element types to choose from */
@@ -1,6 +1,344 @@
 #include "gauss_jacobi_quadrature.h"
 
-/* 
+namespace {
+  /*
+   * Tabulated Gauss-Legendre rules (alpha = beta = 0) up to 16 points
+   *
+   * Building a rule through the eigensolver costs an O(n^3) LAPACK call per
+   * rule, which dominates setup time when many rules are constructed. The
+   * Legendre weight function is by far the most common request, so its rules
+   * are tabulated here and copied out directly. Because the rules are
+   * symmetric about the origin, only the nonpositive half of each rule is
+   * stored (in ascending order) and the rest is mirrored. The entries for an
+   * n-point rule begin at legendre_offsets[n-1] and end at
+   * legendre_offsets[n]
+   */
+  const SizeType max_tabulated_legendre = 16;
+
+  const Real legendre_nodes[] = {
+    0.00000000000000000e+00, -5.77350269189625731e-01, -7.74596669241483404e-01,
+    0.00000000000000000e+00, -8.61136311594052573e-01, -3.39981043584856313e-01,
+    -9.06179845938663964e-01, -5.38469310105683108e-01, 0.00000000000000000e+00,
+    -9.32469514203152050e-01, -6.61209386466264593e-01, -2.38619186083196932e-01,
+    -9.49107912342758486e-01, -7.41531185599394460e-01, -4.05845151377397184e-01,
+    0.00000000000000000e+00, -9.60289856497536287e-01, -7.96666477413626839e-01,
+    -5.25532409916328991e-01, -1.83434642495649808e-01, -9.68160239507626086e-01,
+    -8.36031107326635881e-01, -6.13371432700590469e-01, -3.24253423403808916e-01,
+    0.00000000000000000e+00, -9.73906528517171743e-01, -8.65063366688984536e-01,
+    -6.79409568299024436e-01, -4.33395394129247158e-01, -1.48874338981631216e-01,
+    -9.78228658146056973e-01, -8.87062599768095317e-01, -7.30152005574049356e-01,
+    -5.19096129206811807e-01, -2.69543155952344959e-01, 0.00000000000000000e+00,
+    -9.81560634246719244e-01, -9.04117256370474798e-01, -7.69902674194304693e-01,
+    -5.87317954286617483e-01, -3.67831498998180184e-01, -1.25233408511468913e-01,
+    -9.84183054718588135e-01, -9.17598399222978034e-01, -8.01578090733309878e-01,
+    -6.42349339440340228e-01, -4.48492751036446813e-01, -2.30458315955134802e-01,
+    0.00000000000000000e+00, -9.86283808696812314e-01, -9.28434883663573629e-01,
+    -8.27201315069765020e-01, -6.87292904811685479e-01, -5.15248636358154100e-01,
+    -3.19112368927889745e-01, -1.08054948707343640e-01, -9.87992518020485377e-01,
+    -9.37273392400705951e-01, -8.48206583410427206e-01, -7.24417731360170070e-01,
+    -5.70972172608538830e-01, -3.94151347077563385e-01, -2.01194093997434514e-01,
+    0.00000000000000000e+00, -9.89400934991649939e-01, -9.44575023073232600e-01,
+    -8.65631202387831755e-01, -7.55404408355002999e-01, -6.17876244402643771e-01,
+    -4.58016777657227370e-01, -2.81603550779258915e-01, -9.50125098376374405e-02
+  };
+
+  const Real legendre_weights[] = {
+    2.00000000000000000e+00, 1.00000000000000022e+00, 5.55555555555555247e-01,
+    8.88888888888888840e-01, 3.47854845137453739e-01, 6.52145154862546095e-01,
+    2.36926885056189002e-01, 4.78628670499366471e-01, 5.68888888888888888e-01,
+    1.71324492379170495e-01, 3.60761573048138606e-01, 4.67913934572691259e-01,
+    1.29484966168869675e-01, 2.79705391489276700e-01, 3.81830050505119034e-01,
+    4.17959183673469403e-01, 1.01228536290376175e-01, 2.22381034453374454e-01,
+    3.13706645877887380e-01, 3.62683783378361990e-01, 8.12743883615746343e-02,
+    1.80648160694857562e-01, 2.60610696402935549e-01, 3.12347077040002530e-01,
+    3.30239355001259782e-01, 6.66713443086887347e-02, 1.49451349150580531e-01,
+    2.19086362515982069e-01, 2.69266719309996239e-01, 2.95524224714752926e-01,
+    5.56685671161735382e-02, 1.25580369464904723e-01, 1.86290210927734262e-01,
+    2.33193764591990288e-01, 2.62804544510246707e-01, 2.72925086777900616e-01,
+    4.71753363865118347e-02, 1.06939325995318177e-01, 1.60078328543346332e-01,
+    2.03167426723065841e-01, 2.33492536538354778e-01, 2.49147045813402884e-01,
+    4.04840047653158147e-02, 9.21214998377283822e-02, 1.38873510219787194e-01,
+    1.78145980761945683e-01, 2.07816047536888399e-01, 2.26283180262897149e-01,
+    2.32551553230873898e-01, 3.51194603317519921e-02, 8.01580871597603745e-02,
+    1.21518570687903116e-01, 1.57203167158193602e-01, 1.85538397477937850e-01,
+    2.05198463721295687e-01, 2.15263853463157767e-01, 3.07532419961174946e-02,
+    7.03660474881081383e-02, 1.07159220467172037e-01, 1.39570677926154268e-01,
+    1.66269205816993976e-01, 1.86161000015562100e-01, 1.98431485327111579e-01,
+    2.02578241925561287e-01, 2.71524594117540582e-02, 6.22535239386477757e-02,
+    9.51585116824928967e-02, 1.24628971255533946e-01, 1.49595988816576819e-01,
+    1.69156519395002564e-01, 1.82603415044923612e-01, 1.89450610455068474e-01
+  };
+
+  const SizeType legendre_offsets[] = {
+    0, 1, 2, 4, 6, 9, 12, 16, 20, 25, 30, 36, 42, 49, 56, 64, 72
+  };
+
+  /*
+   * Compute a Gauss-Legendre rule of arbitrary size by Newton iteration on
+   * the roots of the Legendre polynomial
+   *
+   * All roots are iterated in lockstep: the recurrence that evaluates the
+   * polynomial and its derivative runs with the root index as the inner,
+   * unit-stride loop, so there is no per-root convergence branch to diverge
+   * on and the compiler can vectorize across roots. The iteration stops when
+   * the largest update across all roots falls below tolerance. The classical
+   * Chebyshev-based initial guesses put every root in its Newton basin, so
+   * the iteration converges in a handful of sweeps
+   */
+  ELEMENTS_SIMD_DISPATCH
+  void legendre_newton_rule(SizeType n, CArray<Real> &points,
+      CArray<Real> &weights) {
+    // Only the nonpositive half of the rule is computed; the rest is mirrored
+    SizeType half = (n + 1)/2;
+
+    CArray<Real> x(half), p0(half), p1(half), dp(half);
+
+    // Initial guesses (ascending from -1)
+    for (SizeType j = 0; j < half; j++) {
+      x(j) = -std::cos(M_PI*(Real(j) + 0.75)/(Real(n) + 0.5));
+    }
+
+    const SizeType max_iter = 100;
+    for (SizeType it = 0; it < max_iter; it++) {
+      // Evaluate the Legendre polynomial via the three-term recurrence, with
+      // the roots in the inner loop
+      for (SizeType j = 0; j < half; j++) {
+        p0(j) = 1.0;
+        p1(j) = x(j);
+      }
+      for (SizeType k = 2; k <= n; k++) {
+        Real a = (2.0*Real(k) - 1.0)/Real(k), b = (Real(k) - 1.0)/Real(k);
+        for (SizeType j = 0; j < half; j++) {
+          Real p2 = a*x(j)*p1(j) - b*p0(j);
+          p0(j) = p1(j);
+          p1(j) = p2;
+        }
+      }
+
+      // Newton update for all roots, tracking the largest update
+      Real max_delta = 0.0;
+      for (SizeType j = 0; j < half; j++) {
+        dp(j) = Real(n)*(x(j)*p1(j) - p0(j))/(x(j)*x(j) - 1.0);
+        Real delta = p1(j)/dp(j);
+        x(j) -= delta;
+        max_delta = std::max(max_delta, std::abs(delta));
+      }
+
+      if (max_delta < 4.0*NUM_EPS) break;
+    }
+
+    // Points and weights, mirrored onto the positive half. The derivative is
+    // current because the final sweep's updates were below tolerance
+    for (SizeType j = 0; j < half; j++) {
+      Real w_j = 2.0/((1.0 - x(j)*x(j))*dp(j)*dp(j));
+      points(j) = x(j);
+      weights(j) = w_j;
+      points(n-1-j) = -x(j);
+      weights(n-1-j) = w_j;
+    }
+    if (n%2 == 1) points(half-1) = 0.0;
+  }
+
+  /*
+   * Compute a Gauss-Gegenbauer rule (symmetric Jacobi weight, alpha = beta)
+   * of arbitrary size by Newton iteration on the roots of the Jacobi
+   * polynomial
+   *
+   * This follows the lockstep structure of the Legendre routine: only the
+   * nonpositive half of the symmetric rule is iterated, with the root index
+   * as the inner, unit-stride loop. The polynomial derivative comes from the
+   * standard identity (1 - x^2) P_n' = -n x P_n + (n + alpha) P_{n-1}, which
+   * in the symmetric case needs only the last two recurrence values. The
+   * weights are proportional to 1/((1 - x^2) P_n'^2); rather than carry the
+   * gamma-function prefactor through, they are normalized so that their sum
+   * equals the zeroth moment of the weight function, which the rule must
+   * reproduce exactly
+   */
+  ELEMENTS_SIMD_DISPATCH
+  void gegenbauer_newton_rule(SizeType n, Real alpha, CArray<Real> &points,
+      CArray<Real> &weights) {
+    // Only the nonpositive half of the rule is computed; the rest is mirrored
+    SizeType half = (n + 1)/2;
+
+    CArray<Real> x(half), p0(half), p1(half), dp(half);
+
+    // Initial guesses (ascending from -1). The angles generalize the
+    // Chebyshev-based Legendre guesses and are exact for the two Chebyshev
+    // families
+    for (SizeType j = 0; j < half; j++) {
+      Real theta = M_PI*(Real(j) + 0.5*alpha + 0.75)/(Real(n) + alpha + 0.5);
+      x(j) = -std::cos(theta);
+    }
+
+    const SizeType max_iter = 100;
+    for (SizeType it = 0; it < max_iter; it++) {
+      // Evaluate the Jacobi polynomial via the three-term recurrence, with
+      // the roots in the inner loop (the b coefficient vanishes for the
+      // symmetric weight)
+      for (SizeType j = 0; j < half; j++) {
+        p0(j) = 1.0;
+        p1(j) = jacobi::a(alpha, alpha, 1)*x(j);
+      }
+      for (SizeType k = 2; k <= n; k++) {
+        Real a_k = jacobi::a(alpha, alpha, int(k));
+        Real c_k = jacobi::c(alpha, alpha, int(k));
+        for (SizeType j = 0; j < half; j++) {
+          Real p2 = a_k*x(j)*p1(j) - c_k*p0(j);
+          p0(j) = p1(j);
+          p1(j) = p2;
+        }
+      }
+
+      // Newton update for all roots, tracking the largest update
+      Real max_delta = 0.0;
+      for (SizeType j = 0; j < half; j++) {
+        dp(j) = (-Real(n)*x(j)*p1(j) + (Real(n) + alpha)*p0(j))
+            /(1.0 - x(j)*x(j));
+        Real delta = p1(j)/dp(j);
+        x(j) -= delta;
+        max_delta = std::max(max_delta, std::abs(delta));
+      }
+
+      if (max_delta < 4.0*NUM_EPS) break;
+    }
+
+    // Unnormalized weights over the nonpositive half, accumulating the sum
+    // over the full rule (interior points count twice; an odd rule's middle
+    // point once)
+    Real q_sum = 0.0;
+    for (SizeType j = 0; j < half; j++) {
+      dp(j) = 1.0/((1.0 - x(j)*x(j))*dp(j)*dp(j));
+      q_sum += (n%2 == 1 && j == half-1) ? dp(j) : 2.0*dp(j);
+    }
+
+    // Zeroth moment of the weight function (see the beta function note in
+    // the eigensolve path)
+    Real mu0 = std::pow(2.0, 2.0*alpha + 1.0)
+        *std::tgamma(alpha + 1.0)*std::tgamma(alpha + 1.0)
+        /std::tgamma(2.0*alpha + 2.0);
+
+    // Points and normalized weights, mirrored onto the positive half
+    Real scale = mu0/q_sum;
+    for (SizeType j = 0; j < half; j++) {
+      points(j) = x(j);
+      weights(j) = scale*dp(j);
+      points(n-1-j) = -x(j);
+      weights(n-1-j) = scale*dp(j);
+    }
+    if (n%2 == 1) points(half-1) = 0.0;
+  }
+
+  /*
+   * Diagonalize the symmetric tridiagonal Jacobi matrix in place and write
+   * the quadrature rule directly into the output arrays
+   *
+   * This is the Golub-Welsch eigensolve fused into one routine: an
+   * implicit-shift QL iteration runs on the diagonal and subdiagonal (a few
+   * hundred bytes for any practical rule, so the whole problem stays in
+   * cache), and instead of accumulating the full eigenvector matrix, each
+   * plane rotation is applied only to the first eigenvector components,
+   * which are all the weights need. On convergence the eigenvalues are
+   * sorted ascending (carrying the components along) and the weights follow
+   * as the zeroth moment times the squared components. This removes the
+   * LAPACK call, its workspace allocation, and the n-by-n eigenvector
+   * buffer of the previous implementation
+   *
+   * Parameters
+   * ----------
+   * n   : number of quadrature points
+   * d   : diagonal of the Jacobi matrix (destroyed)
+   * e   : subdiagonal of the Jacobi matrix, length n with a zero sentinel in
+   *       the last entry (destroyed)
+   * mu0 : zeroth moment of the weight function
+   *
+   * Returns
+   * -------
+   * points  : quadrature points (ascending)
+   * weights : quadrature weights
+   */
+  void golub_welsch_rule(SizeType n, CArray<Real> &d, CArray<Real> &e,
+      Real mu0, CArray<Real> &points, CArray<Real> &weights) {
+    // First components of the eigenvectors, updated rotation by rotation
+    CArray<Real> z(n);
+    z(0) = 1.0;
+    for (SizeType j = 1; j < n; j++) z(j) = 0.0;
+
+    const SizeType max_iter = 30;
+    for (SizeType l = 0; l < n; l++) {
+      for (SizeType iter = 0; iter <= max_iter; iter++) {
+        // Find the first negligible subdiagonal entry at or past l; the
+        // block [l, m] is what the sweep works on
+        SizeType m = l;
+        while (m < n-1
+            && std::abs(e(m)) > NUM_EPS*(std::abs(d(m)) + std::abs(d(m+1)))) {
+          m++;
+        }
+        if (m == l) break;  // eigenvalue in d(l) has converged
+
+        assert(iter < max_iter
+            and "Error: tridiagonal QL iteration failed to converge");
+
+        // Wilkinson shift from the leading 2x2 block
+        Real g = (d(l+1) - d(l))/(2.0*e(l));
+        Real r = std::hypot(g, 1.0);
+        g = d(m) - d(l) + e(l)/(g + std::copysign(r, g));
+
+        // One implicit QL sweep of plane rotations from m down to l,
+        // rotating the first eigenvector components in the same pass
+        Real s = 1.0, c = 1.0, p = 0.0;
+        bool split = false;
+        for (SizeType i = m; i-- > l;) {
+          Real f = s*e(i), b = c*e(i);
+          r = std::hypot(f, g);
+          e(i+1) = r;
+          if (r == 0.0) {  // rotation annihilated; split the block
+            d(i+1) -= p;
+            e(m) = 0.0;
+            split = true;
+            break;
+          }
+          s = f/r;
+          c = g/r;
+          g = d(i+1) - p;
+          r = (d(i) - g)*s + 2.0*c*b;
+          p = s*r;
+          d(i+1) = g + p;
+          g = c*r - b;
+
+          f = z(i+1);
+          z(i+1) = s*z(i) + c*f;
+          z(i) = c*z(i) - s*f;
+        }
+        if (split) continue;
+
+        d(l) -= p;
+        e(l) = g;
+        e(m) = 0.0;
+      }
+    }
+
+    // Sort the eigenvalues ascending, carrying the first components along
+    // (insertion sort; the rules are small and nearly sorted)
+    for (SizeType j = 1; j < n; j++) {
+      Real dj = d(j), zj = z(j);
+      SizeType i = j;
+      for (; i > 0 && d(i-1) > dj; i--) {
+        d(i) = d(i-1);
+        z(i) = z(i-1);
+      }
+      d(i) = dj;
+      z(i) = zj;
+    }
+
+    // Points and weights in one final pass
+    for (SizeType j = 0; j < n; j++) {
+      points(j) = d(j);
+      weights(j) = mu0*z(j)*z(j);
+    }
+  }
+}
+
+/*
  * For a quadrature rule based on the interpolation of the integrand by a
  * n-degree Jacobi polynomial, compute the quadrature points and weights using
  * the algorithm presented in "Calculation of Guass Quadrature Rules" (Golub
@@ -12,13 +350,52 @@ void compute_gauss_jacobi_quadrature_rule(
   assert(n > 0 and "Error: quadrature rule must have nonzero number of points");
 
   if (n > 1) {
+    // Common weight functions admit direct construction, skipping the
+    // eigensolve below entirely. The Legendre case is copied from the
+    // tabulated half-rules and mirrored; the two Chebyshev cases have closed
+    // forms for the points and weights
+    if (alpha == 0.0 && beta == 0.0 && n <= max_tabulated_legendre) {
+      SizeType start = legendre_offsets[n-1];
+      SizeType half = legendre_offsets[n] - start;
+      for (SizeType j = 0; j < half; j++) {
+        points(j) = legendre_nodes[start+j];
+        weights(j) = legendre_weights[start+j];
+      }
+      for (SizeType j = half; j < n; j++) {
+        points(j) = -legendre_nodes[start+n-1-j];
+        weights(j) = legendre_weights[start+n-1-j];
+      }
+      return;
+    } else if (alpha == 0.0 && beta == 0.0) {  // Legendre, beyond the table
+      legendre_newton_rule(n, points, weights);
+      return;
+    } else if (alpha == -0.5 && beta == -0.5) {  // Chebyshev, first kind
+      for (SizeType j = 0; j < n; j++) {
+        points(j) = std::cos((2.0*Real(n - j) - 1.0)*M_PI/(2.0*Real(n)));
+        weights(j) = M_PI/Real(n);
+      }
+      return;
+    } else if (alpha == 0.5 && beta == 0.5) {  // Chebyshev, second kind
+      for (SizeType j = 0; j < n; j++) {
+        Real theta = Real(n - j)*M_PI/Real(n + 1);
+        Real s = std::sin(theta);
+        points(j) = std::cos(theta);
+        weights(j) = M_PI*s*s/Real(n + 1);
+      }
+      return;
+    } else if (alpha == beta && alpha > -1.0) {  // Gegenbauer, symmetric
+      gegenbauer_newton_rule(n, alpha, points, weights);
+      return;
+    }
+
     // Populate arrays corresponding to the diagonal and subdiagonal (or
-    // superdiagonal) of the symmetric tridiagonal matrix
+    // superdiagonal) of the symmetric tridiagonal matrix. The subdiagonal
+    // carries a zero sentinel in its last entry for the QL iteration
     CArray<Real> diag(n);
-    CArray<Real> subdiag(n-1);
+    CArray<Real> subdiag(n);
 
     for (int k = 0; k < n; k++) {
-      Real 
+      Real
       a_k = common::real(jacobi::a(alpha, beta, k+1)),
       b_k = common::real(jacobi::b(alpha, beta, k+1));
 
@@ -26,19 +403,14 @@ void compute_gauss_jacobi_quadrature_rule(
     }
 
     for (int k = 0; k < n-1; k++) {
-      Real 
+      Real
       a_k   = common::real(jacobi::a(alpha, beta, k+1)),
       a_kp1 = common::real(jacobi::a(alpha, beta, k+2)),
       c_kp1 = common::real(jacobi::c(alpha, beta, k+2));
 
       subdiag(k) = std::sqrt(c_kp1/(a_k*a_kp1));
     }
-
-    // Compute eigensolution of symmetric tridiagonal matrix
-    CArray<Real> eigvals(n);
-    CArray<Real> eigvecs(n,n);
-
-    matar2lapack::eig_sym_tri(diag, subdiag, eigvals, eigvecs);
+    subdiag(n-1) = 0.0;
 
     // Compute zeroth moment (integral of weight function times 1); this integral
     // can be calculated analytically using the beta function (discovered this in
@@ -49,16 +421,64 @@ void compute_gauss_jacobi_quadrature_rule(
         *std::tgamma(common::real(beta + 1.0))
         /std::tgamma(common::real(alpha + beta + 2.0));
 
-    // Extract quadrature points from the eigenvalues and weights from the
-    // magnitude of the eigenvector
-    for (int j = 0; j < n; j++) {
-      points(j) = eigvals(j); 
-
-      Real q_0j = eigvecs(j,0);  // Note: eigvecs are along rows
-      weights(j) = q_0j*q_0j*mu0;
-    }
+    // Diagonalize the tridiagonal matrix in place, writing the points and
+    // weights directly into the output arrays
+    golub_welsch_rule(n, diag, subdiag, mu0, points, weights);
   } else if (n == 1) {
     points(0) = 0;
     weights(0) = 2;
   } 
 }
+
+/*
+ * Return the weighted sum of integrand evaluations at the quadrature points
+ *
+ * Parameters
+ * ----------
+ * weights : quadrature weights
+ * fvals   : integrand evaluations, one per quadrature point
+ */
+ELEMENTS_SIMD_DISPATCH
+Real apply_quadrature_rule(const CArray<Real> &weights,
+    const CArray<Real> &fvals) {
+  SizeType n = weights.size();
+
+  Real sum = 0.0;
+  for (SizeType j = 0; j < n; j++) sum += weights(j)*fvals(j);
+
+  return sum;
+}
+
+/*
+ * Apply a quadrature rule to a batch of integrands in one pass
+ *
+ * Parameters
+ * ----------
+ * weights : quadrature weights
+ * fvals   : integrand evaluations, dimensioned (number of integrands, number
+ *           of quadrature points), so each integrand occupies one contiguous
+ *           row
+ *
+ * Returns
+ * -------
+ * integrals : weighted sums, one per integrand
+ *
+ * Note
+ * ----
+ * The rows are independent and each reduction is unit stride, so the batch
+ * maps directly onto a parallel loop over integrands (or a device
+ * parallel_reduce) without restructuring; in serial the weights are loaded
+ * once per row from cache rather than once per call from memory
+ */
+ELEMENTS_SIMD_DISPATCH
+void apply_quadrature_rule_batch(const CArray<Real> &weights,
+    const CArray<Real> &fvals, CArray<Real> &integrals) {
+  SizeType nf = fvals.dims(0);
+  SizeType n = fvals.dims(1);
+
+  for (SizeType i = 0; i < nf; i++) {
+    Real sum = 0.0;
+    for (SizeType j = 0; j < n; j++) sum += weights(j)*fvals(i,j);
+    integrals(i) = sum;
+  }
+}
@@ -1,9 +1,16 @@
 #pragma once
 
 #include "jacobi_polynomials.h"
-#include "matar_blas_lapack_interface.h"
 #include "error.h"
 #include "common.h"
 
-void compute_gauss_jacobi_quadrature_rule(SizeType n, Real alpha, 
+void compute_gauss_jacobi_quadrature_rule(SizeType n, Real alpha,
     Real beta, CArray<Real> &points, CArray<Real> &weights);
+
+// Application of a quadrature rule to integrand evaluations at the
+// quadrature points, for a single integrand and for a batch of integrands
+// (stored integrand-major, one contiguous row of evaluations per integrand)
+Real apply_quadrature_rule(const CArray<Real> &weights,
+    const CArray<Real> &fvals);
+void apply_quadrature_rule_batch(const CArray<Real> &weights,
+    const CArray<Real> &fvals, CArray<Real> &integrals);
@@ -1,33 +1,83 @@
 #include "jacobi_polynomials.h"
 
+namespace {
+  /*
+   * Fixed-degree kernel behind the Jacobi polynomial evaluation
+   *
+   * The three-term recurrence is run upward with two registers carrying the
+   * previous two polynomial values. With the degree as a template parameter
+   * the loop is fully unrolled, so the per-step multiply-adds chain without
+   * loop overhead
+   */
+  template <int N, typename NumType>
+  inline NumType eval_fixed(const Real alpha, const Real beta,
+      const NumType X) {
+    NumType pm1 = 0.0, p = 1.0;
+    for (int k = 1; k <= N; k++) {
+      NumType pk = (jacobi::a(alpha, beta, k)*X + jacobi::b(alpha, beta, k))*p
+          - jacobi::c(alpha, beta, k)*pm1;
+      pm1 = p;
+      p = pk;
+    }
+    return p;
+  }
+}
+
 namespace jacobi {
+  /*
+   * Return evaluation of the Jacobi polynomial of degree n at a coordinate
+   *
+   * The three-term recurrence is evaluated iteratively from degree 0 upward,
+   * which costs O(n); the previous implementation recursed on the recurrence,
+   * which reevaluated the lower-degree polynomials and cost O(2^n)
+   */
   template <typename NumType>
-  NumType eval(const int n, const Real alpha, const Real beta, 
+  NumType eval(const int n, const Real alpha, const Real beta,
       const NumType X) {
     if (n == -1) return 0.0;
     if (n == 0) return 1.0;
-    return (a(alpha, beta, n)*X + b(alpha, beta, n))
-        *eval(n - 1, alpha, beta, X) 
-        - c(alpha, beta, n)*eval(n - 2, alpha, beta, X);
+
+    // Dispatch the commonly used degrees to fully unrolled kernels
+    switch (n) {
+      case 1: return eval_fixed<1>(alpha, beta, X);
+      case 2: return eval_fixed<2>(alpha, beta, X);
+      case 3: return eval_fixed<3>(alpha, beta, X);
+      case 4: return eval_fixed<4>(alpha, beta, X);
+      case 5: return eval_fixed<5>(alpha, beta, X);
+      case 6: return eval_fixed<6>(alpha, beta, X);
+      case 7: return eval_fixed<7>(alpha, beta, X);
+      case 8: return eval_fixed<8>(alpha, beta, X);
+      default: break;  // fall through to the runtime-degree loop
+    }
+
+    NumType pm1 = 0.0, p = 1.0;
+    for (int k = 1; k <= n; k++) {
+      NumType pk = (a(alpha, beta, k)*X + b(alpha, beta, k))*p
+          - c(alpha, beta, k)*pm1;
+      pm1 = p;
+      p = pk;
+    }
+    return p;
   }
 
   template <typename NumType>
-  NumType eval_der(const int n, const int k, const Real alpha, 
+  NumType eval_der(const int n, const int k, const Real alpha,
       const Real beta, const NumType X) {
-    if (n == 0 || k > n) return 0.0;
+    if (k == 0) return eval(n, alpha, beta, X);  // 0th derivative
+    if (k > n) return 0.0;
     Real theta = Real(n) + Real(alpha + alpha) + 1.0;
     return std::pow(0.5, k)*std::tgamma(theta + Real(k))
         *eval(n - k, alpha + Real(k), beta + Real(k), X)/std::tgamma(theta);
   }
 
   // Explicit instantiations of template functions
-  template Real eval(const int n, const Real alpha, const Real beta, 
+  template Real eval(const int n, const Real alpha, const Real beta,
       const Real X);
-  template Complex eval(const int n, const Real alpha, const Real beta, 
+  template Complex eval(const int n, const Real alpha, const Real beta,
       const Complex X);
 
-  template Real eval_der(const int n, const int k, const Real alpha, 
+  template Real eval_der(const int n, const int k, const Real alpha,
       const Real beta, const Real X);
-  template Complex eval_der(const int n, const int k, const Real alpha, 
+  template Complex eval_der(const int n, const int k, const Real alpha,
       const Real beta, const Complex X);
 }
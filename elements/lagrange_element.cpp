@@ -1,9 +1,41 @@
 #include "lagrange_element.h"
 #include "lagrange_polynomials.h"
 
+namespace {
+  /*
+   * Return a pointer to a thread-local scratch arena of at least n entries
+   *
+   * The sum-factorized evaluation routines draw their work arrays from this
+   * arena instead of from per-instance members, so one element instance can
+   * be shared across threads without the intermediate contractions of one
+   * thread overwriting those of another (or ping-ponging cache lines between
+   * cores). The arena is allocated aligned, grows monotonically to the
+   * largest size requested on the calling thread, and is released at thread
+   * exit
+   */
+  template <typename NumType>
+  NumType *thread_workspace(const SizeType n) {
+    struct Arena {
+      NumType *p = nullptr;
+      SizeType cap = 0;
+      ~Arena() { common::deallocate_aligned(p); }
+    };
+    thread_local Arena arena;
+
+    if (arena.cap < n) {
+      common::deallocate_aligned(arena.p);
+      arena.p = common::allocate_aligned<NumType>(n);
+      arena.cap = n;
+    }
+
+    return ELEMENTS_ASSUME_ALIGNED(arena.p);
+  }
+}
+
 template <typename NumType>
-LagrangeElement<NumType>::LagrangeElement(const SizeType order, 
-    const NumType *vert_coords) : Np(order), Z(vert_coords) {
+LagrangeElement<NumType>::LagrangeElement(const SizeType order,
+    const NumType *vert_coords) : Np(order), Z(vert_coords), B(nullptr),
+    D(nullptr), Nq(0) {
   N = Np + 1;
   Ne = std::pow(N, Nd);
 
@@ -11,17 +43,52 @@ LagrangeElement<NumType>::LagrangeElement(const SizeType order,
   rad[1] = N;
   rad[2] = N;
 
-  // Allocate memory for weights and compute
-  w = new NumType[N];
+  // Allocate memory for weights and compute. The weights are allocated
+  // aligned so vector loads and stores on them do not straddle cache lines
+  w = common::allocate_aligned<NumType>(N);
   lagrange::compute_barycentric_weights(N, Z, w);
-
-  // Allocate memory for intermediate coefficients
-  C = new NumType[3*N];
 }
 
 template <typename NumType>
 LagrangeElement<NumType>::~LagrangeElement() {
-  delete [] w, C;
+  common::deallocate_aligned(w);
+  common::deallocate_aligned(B);
+  common::deallocate_aligned(D);
+}
+
+/*
+ * Precompute the 1D basis function values and derivatives at the points of a
+ * 1D quadrature rule
+ *
+ * Parameters
+ * ----------
+ * quad_pts : coordinates of the 1D quadrature points (in reference space)
+ * nQuad    : number of 1D quadrature points
+ *
+ * Note
+ * ----
+ * An element loop that integrates over a fixed rule reevaluates the same 1D
+ * basis functions at every element. Tabulating them once here turns the
+ * per-point 1D evaluations in the quadrature-indexed routines into row
+ * lookups, leaving only the contractions in the loop. Calling this routine
+ * again replaces any previously tabulated rule
+ */
+template <typename NumType>
+void LagrangeElement<NumType>::precompute_at(const NumType *quad_pts,
+    const SizeType nQuad) {
+  if (Nq != nQuad) {
+    common::deallocate_aligned(B);
+    common::deallocate_aligned(D);
+    B = common::allocate_aligned<NumType>(nQuad*N);
+    D = common::allocate_aligned<NumType>(nQuad*N);
+    Nq = nQuad;
+  }
+
+  for (SizeType q = 0; q < Nq; q++) {
+    SizeType iq = lagrange::find_coincident_vertex(N, Z, quad_pts[q]);
+    lagrange::eval_all(N, iq, Z, w, quad_pts[q], &B[q*N]);
+    lagrange::eval_der_all(N, iq, Z, w, quad_pts[q], &D[q*N]);
+  }
 }
 
 /*
@@ -83,6 +150,7 @@ void LagrangeElement<NumType>::eval_grad_basis(const SizeType I,
   
   // Evaluate Lagrange polynomial derivatives
   SizeType n = 1;  // order of derivative
+  NumType *C = thread_workspace<NumType>(2*N*N + 9*N);
   NumType dli = lagrange::eval_der(N, n, ijk[0], ix, Z, w, X[0], C);
   NumType dlj = lagrange::eval_der(N, n, ijk[1], iy, Z, w, X[1], C);
   NumType dlk = lagrange::eval_der(N, n, ijk[2], iz, Z, w, X[2], C);
@@ -93,6 +161,130 @@ void LagrangeElement<NumType>::eval_grad_basis(const SizeType I,
   grad_phi[2] = li*lj*dlk;
 }
 
+/*
+ * Evaluate the gradients of all basis functions at specified coordinates
+ *
+ * Parameters
+ * ----------
+ * X : coordinates (in reference space)
+ *
+ * Returns
+ * -------
+ * grad_phi : gradients of all basis functions, stored component-major: the
+ *            X-derivatives of all basis functions occupy the first block of
+ *            length equal to the number of basis functions, then the
+ *            Y-derivatives, then the Z-derivatives
+ *
+ * Note
+ * ----
+ * The component-major (structure of arrays) layout keeps each derivative
+ * component a contiguous, unit-stride block, so assembly loops that contract
+ * one component against nodal data vectorize without gathers. Within each
+ * block the basis index runs fastest in the first dimension, matching the
+ * mixed-radix decomposition used by the single-basis routines, and the 2D
+ * factors are hoisted out of the inner loop
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+void LagrangeElement<NumType>::eval_grad_basis_all(
+    const NumType *ELEMENTS_RESTRICT X, NumType *ELEMENTS_RESTRICT grad_phi) {
+  this->eval_basis_1d(X);
+
+  const NumType *L = thread_workspace<NumType>(2*N*N + 9*N) + 2*N*N + 3*N;
+  const NumType *lx = &L[0], *ly = &L[N], *lz = &L[2*N];
+  const NumType *dlx = &L[3*N], *dly = &L[4*N], *dlz = &L[5*N];
+
+  NumType *gx = grad_phi, *gy = grad_phi + Ne, *gz = grad_phi + 2*Ne;
+  for (SizeType k = 0; k < N; k++) {
+    for (SizeType j = 0; j < N; j++) {
+      NumType vv = ly[j]*lz[k];
+      NumType dv = dly[j]*lz[k];
+      NumType vd = ly[j]*dlz[k];
+      for (SizeType i = 0; i < N; i++) {
+        SizeType I = i + j*N + k*N*N;
+        gx[I] = dlx[i]*vv;
+        gy[I] = lx[i]*dv;
+        gz[I] = lx[i]*vd;
+      }
+    }
+  }
+}
+
+/*
+ * Evaluate a basis function at multiple points
+ *
+ * Parameters
+ * ----------
+ * I    : index of basis function
+ * nPts : number of points
+ * X    : coordinates (in reference space), stored dimension-major, i.e. the
+ *        coordinates in the first dimension of all points, then the
+ *        coordinates in the second dimension of all points, and so on
+ *
+ * Returns
+ * -------
+ * phi : basis function evaluations, one per point
+ *
+ * Note
+ * ----
+ * The point loop carries no dependences and both the coordinate loads and the
+ * evaluation stores are unit stride in the point index, so the compiler is
+ * free to vectorize across points. This is in contrast to the single-point
+ * routine, whose short loops over the vertices are awkward to vectorize.
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+void LagrangeElement<NumType>::eval_basis_batch(const SizeType I,
+    const SizeType nPts, const NumType *ELEMENTS_RESTRICT X,
+    NumType *ELEMENTS_RESTRICT phi) {
+  // Decompose index of 3D tensor product basis function into indices of
+  // Lagrange polynomials
+  common::base_10_to_mixed_radix(Nd, rad, I, ijk);
+
+  const NumType *Xx = X, *Xy = X + nPts, *Xz = X + 2*nPts;
+
+  for (SizeType p = 0; p < nPts; p++) {
+    // Check coincidence of coordinates with vertex coordinates
+    SizeType ix = lagrange::find_coincident_vertex(N, Z, Xx[p]);
+    SizeType iy = lagrange::find_coincident_vertex(N, Z, Xy[p]);
+    SizeType iz = lagrange::find_coincident_vertex(N, Z, Xz[p]);
+
+    // Evaluate Lagrange polynomials
+    NumType li = lagrange::eval(N, ijk[0], ix, Z, w, Xx[p]);
+    NumType lj = lagrange::eval(N, ijk[1], iy, Z, w, Xy[p]);
+    NumType lk = lagrange::eval(N, ijk[2], iz, Z, w, Xz[p]);
+
+    phi[p] = li*lj*lk;
+  }
+}
+
+/*
+ * Evaluate the local function approximation at multiple points
+ *
+ * Parameters
+ * ----------
+ * c    : coefficients
+ * nPts : number of points
+ * X    : coordinates (in reference space), stored dimension-major (see the
+ *        batched basis evaluation routine)
+ *
+ * Returns
+ * -------
+ * f : approximation evaluations, one per point
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+void LagrangeElement<NumType>::eval_approx_batch(
+    const NumType *ELEMENTS_RESTRICT c, const SizeType nPts,
+    const NumType *ELEMENTS_RESTRICT X, NumType *ELEMENTS_RESTRICT f) {
+  const NumType *Xx = X, *Xy = X + nPts, *Xz = X + 2*nPts;
+
+  for (SizeType p = 0; p < nPts; p++) {
+    NumType Xp[Nd] = {Xx[p], Xy[p], Xz[p]};
+    f[p] = this->eval_approx(c, Xp);
+  }
+}
+
 /*
  * Return evaluation of local function approximation, which is formed by
  * the sum of the products of tensor-product Lagrange basis functions and the
@@ -105,37 +297,218 @@ void LagrangeElement<NumType>::eval_grad_basis(const SizeType I,
  *
  * Note
  * ----
- * The intermediate coefficients or workspace array is divided into 3 lines of
- * length equal to the number of vertices. In the dimension-by-dimension
- * approach used for the approximation evaluation, each line is filled by
- * evaluations at the previous dimensional level. The initial coefficients are
- * cycled through in the X-dimension loop to produce coefficients, stored in
- * the workspace array, to be used in the Y-dimension loop. The output from the
- * Y-dimension loop is coefficients, stored again in the workspace array, to be
- * used in the final Z-dimension evaluation. This process, as described, only
- * requires 2 lines of workspace. The extra line of workspace is needed for
- * derivative evaluations, and so it is unused here.
+ * This routine uses sum factorization: the 1D basis evaluations are hoisted
+ * out of the tensor-product contraction, and the coefficient tensor is
+ * contracted one dimension at a time through the workspace array. The first
+ * contraction collapses the X dimension into a plane of N*N intermediate
+ * coefficients (stored in the first plane of the workspace array). The second
+ * contraction collapses that plane into a line of N coefficients (stored in
+ * the line section of the workspace array), and the final contraction
+ * collapses the line into the interpolant evaluation. Relative to evaluating
+ * the interpolant basis function by basis function, this reduces both the
+ * floating point work and the traffic through the coefficient array.
  */
 template <typename NumType>
-NumType LagrangeElement<NumType>::eval_approx(const NumType *c, 
+NumType LagrangeElement<NumType>::eval_approx(const NumType *c,
     const NumType *X) {
   // Check the coincidence of the coordinates with vertex coordinates
   SizeType ix = lagrange::find_coincident_vertex(N, Z, X[0]);
   SizeType iy = lagrange::find_coincident_vertex(N, Z, X[1]);
   SizeType iz = lagrange::find_coincident_vertex(N, Z, X[2]);
 
-  for (int k = 0; k < N; k++) {
-    for (int j = 0; j < N; j++) {
-      // Collapse first dimension into coefficients for second dimension
-      C[j] = lagrange::eval_interp(N, ix, Z, w, X[0], &c[j*N+k*N*N]);
+  // Draw the work arrays from the thread-local scratch arena: two planes and
+  // three lines of intermediate coefficients, then six lines of 1D basis
+  // evaluations (this routine uses the first three)
+  NumType *C = thread_workspace<NumType>(2*N*N + 9*N);
+  NumType *L = C + 2*N*N + 3*N;
+
+  // Evaluate the 1D basis functions in each dimension
+  NumType *lx = L, *ly = L + N, *lz = L + 2*N;
+  lagrange::eval_all(N, ix, Z, w, X[0], lx);
+  lagrange::eval_all(N, iy, Z, w, X[1], ly);
+  lagrange::eval_all(N, iz, Z, w, X[2], lz);
+
+  return this->contract_approx(c, lx, ly, lz);
+}
+
+/*
+ * Contract the provided coefficients against the provided 1D basis function
+ * values via sum factorization (see the approximation routine)
+ *
+ * Parameters
+ * ----------
+ * c          : coefficients
+ * lx, ly, lz : 1D basis function values in each dimension
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+NumType LagrangeElement<NumType>::contract_approx(
+    const NumType *ELEMENTS_RESTRICT c, const NumType *lx, const NumType *ly,
+    const NumType *lz) {
+  NumType *C = thread_workspace<NumType>(2*N*N + 9*N);
+
+  // Accumulate partial sums in the accumulation type associated with the
+  // storage type, so reduced-precision instantiations lose precision only in
+  // the stored intermediates, not in the summations
+  typedef typename common::accum_type<NumType>::type AccumType;
+
+  // Collapse first dimension into a plane of coefficients for the second
+  // dimension
+  for (SizeType k = 0; k < N; k++) {
+    for (SizeType j = 0; j < N; j++) {
+      AccumType s = 0.0;
+      for (SizeType i = 0; i < N; i++) s += lx[i]*c[i+j*N+k*N*N];
+      C[j+k*N] = s;
     }
+  }
 
-    // Collapse second dimension into coefficients for third dimension
-    C[N+k] = lagrange::eval_interp(N, iy, Z, w, X[1], C);
+  // Collapse second dimension into a line of coefficients for the third
+  // dimension
+  NumType *t = &C[2*N*N];
+  for (SizeType k = 0; k < N; k++) {
+    AccumType s = 0.0;
+    for (SizeType j = 0; j < N; j++) s += ly[j]*C[j+k*N];
+    t[k] = s;
   }
 
   // Collapse third dimension into interpolant evaluation
-  return lagrange::eval_interp(N, iz, Z, w, X[2], &C[N]);
+  AccumType p = 0.0;
+  for (SizeType k = 0; k < N; k++) p += lz[k]*t[k];
+
+  return p;
+}
+
+/*
+ * Return evaluation of the local function approximation at a point of a
+ * tensor-product quadrature rule
+ *
+ * Parameters
+ * ----------
+ * c          : coefficients
+ * qx, qy, qz : indices of the 1D quadrature points making up the
+ *              tensor-product quadrature point
+ *
+ * Note
+ * ----
+ * The 1D basis values must have been tabulated by a preceding call to the
+ * precomputation routine; this routine reads the tabulated rows instead of
+ * reevaluating the 1D basis functions
+ */
+template <typename NumType>
+NumType LagrangeElement<NumType>::eval_approx_quad(const NumType *c,
+    const SizeType qx, const SizeType qy, const SizeType qz) {
+  return this->contract_approx(c, &B[qx*N], &B[qy*N], &B[qz*N]);
+}
+
+/*
+ * Evaluate the local function approximation at every point of the tabulated
+ * tensor-product quadrature rule
+ *
+ * Parameters
+ * ----------
+ * c : coefficients
+ *
+ * Returns
+ * -------
+ * f : approximation evaluations at all tensor-product quadrature points,
+ *     stored with the first 1D point index running fastest
+ *
+ * Note
+ * ----
+ * Once the 1D values are tabulated, sweeping over all quadrature points
+ * turns each directional contraction of the sum factorization into a small
+ * dense matrix product between the tabulated matrix and the partially
+ * contracted coefficients. The sweeps here are laid out so the innermost
+ * loop of each is unit stride in both operands: the first contracts the
+ * tabulated rows against the coefficient columns, and the remaining two
+ * accumulate scaled columns of the previous intermediate. Batching the
+ * points this way amortizes the loop overhead of the single-point routine
+ * and keeps every load and store contiguous
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+void LagrangeElement<NumType>::eval_approx_quad_all(
+    const NumType *ELEMENTS_RESTRICT c, NumType *ELEMENTS_RESTRICT f) {
+  typedef typename common::accum_type<NumType>::type AccumType;
+
+  // Intermediates: the first sweep produces a (Nq, N*N) block and the second
+  // a (Nq*Nq, N) block, both with the quadrature indices running fastest
+  NumType *T1 = thread_workspace<NumType>(Nq*N*N + Nq*Nq*N);
+  NumType *T2 = T1 + Nq*N*N;
+
+  // Contract the first dimension: T1(qx, j + k*N) = sum_i B(qx, i) c(i, j, k)
+  for (SizeType m = 0; m < N*N; m++) {
+    for (SizeType q = 0; q < Nq; q++) {
+      AccumType s = 0.0;
+      for (SizeType i = 0; i < N; i++) s += B[q*N+i]*c[i+m*N];
+      T1[q+m*Nq] = s;
+    }
+  }
+
+  // Contract the second dimension:
+  // T2(qx + qy*Nq, k) = sum_j B(qy, j) T1(qx, j + k*N)
+  for (SizeType k = 0; k < N; k++) {
+    for (SizeType qy = 0; qy < Nq; qy++) {
+      NumType *t2 = &T2[qy*Nq + k*Nq*Nq];
+      for (SizeType qx = 0; qx < Nq; qx++) t2[qx] = 0.0;
+      for (SizeType j = 0; j < N; j++) {
+        const NumType b = B[qy*N+j];
+        const NumType *t1 = &T1[(j+k*N)*Nq];
+        for (SizeType qx = 0; qx < Nq; qx++) t2[qx] += b*t1[qx];
+      }
+    }
+  }
+
+  // Contract the third dimension:
+  // f(qx + qy*Nq + qz*Nq*Nq) = sum_k B(qz, k) T2(qx + qy*Nq, k)
+  for (SizeType qz = 0; qz < Nq; qz++) {
+    NumType *fq = &f[qz*Nq*Nq];
+    for (SizeType p = 0; p < Nq*Nq; p++) fq[p] = 0.0;
+    for (SizeType k = 0; k < N; k++) {
+      const NumType b = B[qz*N+k];
+      const NumType *t2 = &T2[k*Nq*Nq];
+      for (SizeType p = 0; p < Nq*Nq; p++) fq[p] += b*t2[p];
+    }
+  }
+}
+
+/*
+ * Evaluate the gradient of the local function approximation at a point of a
+ * tensor-product quadrature rule
+ *
+ * Parameters
+ * ----------
+ * c          : coefficients
+ * qx, qy, qz : indices of the 1D quadrature points making up the
+ *              tensor-product quadrature point
+ *
+ * Returns
+ * -------
+ * grad_f : gradient of the interpolant
+ *
+ * Note
+ * ----
+ * As in the quadrature-indexed approximation routine, the 1D basis values
+ * and derivatives are read from the tabulated rows. They are copied into the
+ * 1D work array so the gradient contraction is shared with the
+ * coordinate-based routine
+ */
+template <typename NumType>
+void LagrangeElement<NumType>::eval_grad_approx_quad(const NumType *c,
+    const SizeType qx, const SizeType qy, const SizeType qz,
+    NumType *grad_f) {
+  NumType *L = thread_workspace<NumType>(2*N*N + 9*N) + 2*N*N + 3*N;
+
+  for (SizeType i = 0; i < N; i++) {
+    L[i] = B[qx*N+i];
+    L[N+i] = B[qy*N+i];
+    L[2*N+i] = B[qz*N+i];
+    L[3*N+i] = D[qx*N+i];
+    L[4*N+i] = D[qy*N+i];
+    L[5*N+i] = D[qz*N+i];
+  }
+
+  this->contract_grad(c, grad_f);
 }
 
 /*
@@ -154,51 +527,126 @@ NumType LagrangeElement<NumType>::eval_approx(const NumType *c,
  *
  * Note
  * ----
- * This routine uses a dimension-by-dimension approach as in the approximation
- * routine. See the documentation of that routine for details. This routine
- * differs from that one in that the first line of the workspace array is
- * reserved for the derivative evaluations. These derivative evaluations use
- * the first line to store divided differences.
+ * This routine uses sum factorization as in the approximation routine. See
+ * the documentation of that routine for details. This routine differs from
+ * that one in that it needs 1D basis function derivatives in addition to 1D
+ * basis function values, and in that the intermediate contractions are shared
+ * between the components of the gradient. The value-based contraction of the
+ * first dimension (the first plane of the workspace array) feeds the Y and Z
+ * components, while the derivative-based contraction (the second plane) feeds
+ * the X component; the three second-dimension contractions (the three lines
+ * of the workspace array) then differ only in whether values or derivatives
+ * are applied in the remaining dimensions.
  */
 template <typename NumType>
-void LagrangeElement<NumType>::eval_grad_approx(const NumType *c, 
+void LagrangeElement<NumType>::eval_grad_approx(const NumType *c,
     const NumType *X, NumType *grad_f) {
-  const SizeType n = 1; // order of partial derivative
+  this->eval_basis_1d(X);
+  this->contract_grad(c, grad_f);
+}
 
+/*
+ * Evaluate the 1D basis functions and derivatives in each dimension and store
+ * them in the 1D work array
+ *
+ * Parameters
+ * ----------
+ * X : coordinates (in reference space)
+ */
+template <typename NumType>
+void LagrangeElement<NumType>::eval_basis_1d(const NumType *X) {
   // Check the coincidence of the coordinates with vertex coordinates
   SizeType ix = lagrange::find_coincident_vertex(N, Z, X[0]);
   SizeType iy = lagrange::find_coincident_vertex(N, Z, X[1]);
   SizeType iz = lagrange::find_coincident_vertex(N, Z, X[2]);
 
-  for (int l = 0; l < Nd; l++) {
-    for (int k = 0; k < N; k++) {
-      for (int j = 0; j < N; j++) {
-        // Collapse first dimension into coefficients for second dimension
-        std::copy(c+j*N+k*N*N, c+j*N+k*N*N+N, C);  // load first line
-        if (l == 0) {
-          C[N+j] = lagrange::eval_der_interp(N, n, ix, Z, w, X[0], C);
-        } else {
-          C[N+j] = lagrange::eval_interp(N, ix, Z, w, X[0], C);
-        }
-      }
+  // The 1D work array lives past the intermediate coefficients in the
+  // thread-local scratch arena; the contraction routine recovers the same
+  // pointer, so the split evaluation stays on one thread's scratch
+  NumType *L = thread_workspace<NumType>(2*N*N + 9*N) + 2*N*N + 3*N;
+
+  lagrange::eval_all(N, ix, Z, w, X[0], &L[0]);
+  lagrange::eval_all(N, iy, Z, w, X[1], &L[N]);
+  lagrange::eval_all(N, iz, Z, w, X[2], &L[2*N]);
 
-      // Collapse second dimension into coefficients for third dimension
-      std::copy(C+N, C+2*N, C); // second line back into first line
-      if (l == 1) {
-        C[2*N+k] = lagrange::eval_der_interp(N, n, iy, Z, w, X[1], C);
-      } else {
-        C[2*N+k] = lagrange::eval_interp(N, iy, Z, w, X[1], C);
+  lagrange::eval_der_all(N, ix, Z, w, X[0], &L[3*N]);
+  lagrange::eval_der_all(N, iy, Z, w, X[1], &L[4*N]);
+  lagrange::eval_der_all(N, iz, Z, w, X[2], &L[5*N]);
+}
+
+/*
+ * Contract the provided coefficients with the 1D basis evaluations stored in
+ * the 1D work array to produce a gradient evaluation
+ *
+ * Parameters
+ * ----------
+ * c : coefficients
+ *
+ * Returns
+ * -------
+ * grad_f : gradient of the interpolant
+ *
+ * Note
+ * ----
+ * The 1D work array must have been filled by a preceding call to the 1D
+ * evaluation routine. Splitting the evaluation this way lets the Jacobian
+ * routine contract the x, y, and z coordinate arrays against one set of 1D
+ * evaluations instead of recomputing them per component
+ */
+template <typename NumType>
+ELEMENTS_SIMD_DISPATCH
+void LagrangeElement<NumType>::contract_grad(
+    const NumType *ELEMENTS_RESTRICT c, NumType *ELEMENTS_RESTRICT grad_f) {
+  NumType *C = thread_workspace<NumType>(2*N*N + 9*N);
+  NumType *L = C + 2*N*N + 3*N;
+  const NumType *lx = &L[0], *ly = &L[N], *lz = &L[2*N];
+  const NumType *dlx = &L[3*N], *dly = &L[4*N], *dlz = &L[5*N];
+
+  // Accumulate partial sums in the accumulation type associated with the
+  // storage type (see the approximation routine)
+  typedef typename common::accum_type<NumType>::type AccumType;
+
+  // Collapse first dimension into planes of coefficients for the second
+  // dimension, contracting with values (for the Y and Z components) and
+  // derivatives (for the X component)
+  NumType *Cv = C, *Cd = &C[N*N];
+  for (SizeType k = 0; k < N; k++) {
+    for (SizeType j = 0; j < N; j++) {
+      AccumType sv = 0.0, sd = 0.0;
+      for (SizeType i = 0; i < N; i++) {
+        sv += lx[i]*c[i+j*N+k*N*N];
+        sd += dlx[i]*c[i+j*N+k*N*N];
       }
+      Cv[j+k*N] = sv;
+      Cd[j+k*N] = sd;
     }
+  }
 
-    // Collapse third dimension into interpolant evaluation
-    std::copy(C+2*N, C+3*N, C); // third line back into first line
-    if (l == 2) {
-      grad_f[l] = lagrange::eval_der_interp(N, n, iz, Z, w, X[2], C);
-    } else {
-      grad_f[l] = lagrange::eval_interp(N, iz, Z, w, X[2], C);
+  // Collapse second dimension into lines of coefficients for the third
+  // dimension
+  NumType *tdv = &C[2*N*N], *tvd = &C[2*N*N+N], *tvv = &C[2*N*N+2*N];
+  for (SizeType k = 0; k < N; k++) {
+    AccumType sdv = 0.0, svd = 0.0, svv = 0.0;
+    for (SizeType j = 0; j < N; j++) {
+      sdv += ly[j]*Cd[j+k*N];
+      svd += dly[j]*Cv[j+k*N];
+      svv += ly[j]*Cv[j+k*N];
     }
+    tdv[k] = sdv;
+    tvd[k] = svd;
+    tvv[k] = svv;
   }
+
+  // Collapse third dimension into the components of the gradient
+  AccumType gx = 0.0, gy = 0.0, gz = 0.0;
+  for (SizeType k = 0; k < N; k++) {
+    gx += lz[k]*tdv[k];
+    gy += lz[k]*tvd[k];
+    gz += dlz[k]*tvv[k];
+  }
+  grad_f[0] = gx;
+  grad_f[1] = gy;
+  grad_f[2] = gz;
 }
 
 /*
@@ -216,16 +664,21 @@ void LagrangeElement<NumType>::eval_grad_approx(const NumType *c,
  * J : Jacobian (stored in column-major order)
  */
 template <typename NumType>
-void LagrangeElement<NumType>::eval_jac(const NumType *x, const NumType *y, 
+void LagrangeElement<NumType>::eval_jac(const NumType *x, const NumType *y,
     const NumType *z, const NumType *X, NumType *J) {
+  // Evaluate the 1D basis functions and derivatives once; the coordinate
+  // arrays are stored one contiguous array per component, so each row of the
+  // Jacobian is a unit-stride contraction against the shared 1D evaluations
+  this->eval_basis_1d(X);
+
   // Evaluate the gradient of x = x(X, Y, Z)
-  this->eval_grad_approx(x, X, J);
+  this->contract_grad(x, J);
 
   // Evaluate the gradient of y = y(X, Y, Z)
-  this->eval_grad_approx(y, X, J+3);
+  this->contract_grad(y, J+3);
 
   // Evaluate the gradient of z = z(X, Y, Z)
-  this->eval_grad_approx(z, X, J+6);
+  this->contract_grad(z, J+6);
 }
 
 /*
@@ -262,22 +715,59 @@ NumType LagrangeElement<NumType>::eval_det_jac(const NumType *x,
  * Jinv : Jacobian inverse (stored in column-major order)
  */
 template <typename NumType>
-void LagrangeElement<NumType>::eval_inv_jac(const NumType *x, const NumType *y, 
+void LagrangeElement<NumType>::eval_inv_jac(const NumType *x, const NumType *y,
     const NumType *z, const NumType *X, NumType *Jinv) {
-  NumType J[9];
+  NumType J[9], det_J;
+  this->eval_jac_det_inv(x, y, z, X, J, det_J, Jinv);
+}
+
+/*
+ * Evaluate the Jacobian of the spatial mapping along with its determinant and
+ * inverse
+ *
+ * The three quantities share the Jacobian evaluation, so computing them
+ * together makes a single pass through the coordinate arrays, where calling
+ * the individual routines traverses the coordinate arrays once per quantity.
+ * The determinant is computed once and its reciprocal scales the cofactors of
+ * the closed-form 3x3 inverse
+ *
+ * Parameters
+ * ----------
+ * x : x coordinates in physical space
+ * y : y coordinates in physical space
+ * z : z coordinates in physical space
+ * X : coordinates in reference space at which to evaluate
+ *
+ * Returns
+ * -------
+ * J     : Jacobian (stored in column-major order)
+ * det_J : determinant of the Jacobian
+ * Jinv  : Jacobian inverse (stored in column-major order)
+ */
+template <typename NumType>
+void LagrangeElement<NumType>::eval_jac_det_inv(const NumType *x,
+    const NumType *y, const NumType *z, const NumType *X, NumType *J,
+    NumType &det_J, NumType *Jinv) {
   this->eval_jac(x, y, z, X, J);
 
-  NumType d = 1.0/(this->eval_det_jac(x, y, z, X));
+  // Cofactors of the Jacobian
+  NumType c00 = J[4]*J[8] - J[5]*J[7];
+  NumType c01 = J[3]*J[8] - J[5]*J[6];
+  NumType c02 = J[3]*J[7] - J[4]*J[6];
+
+  det_J = J[0]*c00 - J[1]*c01 + J[2]*c02;
 
-  Jinv[0] = d*(J[4]*J[8] - J[5]*J[7]);
+  NumType d = 1.0/det_J;
+
+  Jinv[0] = d*c00;
   Jinv[1] = -d*(J[1]*J[8] - J[2]*J[7]);
   Jinv[2] = d*(J[1]*J[5] - J[2]*J[4]);
 
-  Jinv[3] = -d*(J[3]*J[8] - J[5]*J[6]);
+  Jinv[3] = -d*c01;
   Jinv[4] = d*(J[0]*J[8] - J[2]*J[6]);
   Jinv[5] = -d*(J[0]*J[5] - J[2]*J[3]);
 
-  Jinv[6] = d*(J[3]*J[7] - J[4]*J[6]);
+  Jinv[6] = d*c02;
   Jinv[7] = -d*(J[0]*J[7] - J[1]*J[6]);
   Jinv[8] = d*(J[0]*J[4] - J[1]*J[3]);
 }
@@ -285,3 +775,9 @@ void LagrangeElement<NumType>::eval_inv_jac(const NumType *x, const NumType *y,
 // Explicit instantiation of template class
 template class LagrangeElement<Real>;
 template class LagrangeElement<Complex>;
+
+// Reduced-precision instantiation. Vertex coordinates, barycentric weights,
+// and the work arrays are stored in single precision, which halves the
+// traffic through the workspace in the memory-bound contractions; the
+// contraction kernels still accumulate in double via common::accum_type
+template class LagrangeElement<float>;
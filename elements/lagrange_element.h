@@ -2,6 +2,9 @@
 
 #include "common.h"
 
+// Tensor-product Lagrange element. The evaluation routines annotate their
+// pointer parameters as non-aliasing in the implementation, so output arrays
+// passed to them must not overlap the coefficient or coordinate inputs
 template <typename NumType>
 struct LagrangeElement {
   // Element specifications
@@ -16,8 +19,18 @@ struct LagrangeElement {
   SizeType ijk[Nd];
   SizeType rad[Nd];
 
-  // Work array for intermediate coefficients
-  NumType *C;
+  // Precomputed 1D basis function values (B) and derivatives (D) at the
+  // points of a 1D quadrature rule, stored point-major (one row of N entries
+  // per quadrature point). Filled by the precomputation routine; empty until
+  // then
+  NumType *B;
+  NumType *D;
+  SizeType Nq;
+
+  // The work arrays for the intermediate coefficients and 1D basis function
+  // evaluations used by the sum-factorized evaluation routines are not
+  // members; they live in a thread-local scratch arena (see the
+  // implementation), so one element instance can be shared across threads
 
   LagrangeElement(const SizeType, const NumType *);
   ~LagrangeElement();
@@ -26,15 +39,63 @@ struct LagrangeElement {
   NumType eval_basis(const SizeType, const NumType *);
   void eval_grad_basis(const SizeType, const NumType *, NumType *);
 
+  // Gradients of all basis functions at one point, stored component-major
+  // (structure of arrays): the X-derivatives of all basis functions, then
+  // the Y-derivatives, then the Z-derivatives, each a contiguous block
+  void eval_grad_basis_all(const NumType *, NumType *);
+
+  // Batched variants of basis function evaluation and function approximation
+  // that process multiple points per call. The coordinates are laid out
+  // dimension-major, so that each dimension occupies a contiguous array of
+  // length equal to the number of points
+  void eval_basis_batch(const SizeType, const SizeType, const NumType *,
+      NumType *);
+  void eval_approx_batch(const NumType *, const SizeType, const NumType *,
+      NumType *);
+
   // Function approximation over element
   NumType eval_approx(const NumType *, const NumType *);
   void eval_grad_approx(const NumType *, const NumType *, NumType *);
 
+  // Precomputation of the 1D basis values and derivatives at the points of a
+  // 1D quadrature rule, and evaluation at a quadrature point addressed by
+  // its 1D point indices. The per-point 1D evaluations are table lookups in
+  // these routines, so an element loop over a fixed rule pays only for the
+  // contractions
+  void precompute_at(const NumType *, const SizeType);
+  NumType eval_approx_quad(const NumType *, const SizeType, const SizeType,
+      const SizeType);
+  void eval_grad_approx_quad(const NumType *, const SizeType, const SizeType,
+      const SizeType, NumType *);
+
+  // Evaluation of the local function approximation at every point of the
+  // tabulated tensor-product rule in one call. The evaluations are stored
+  // with the first 1D point index running fastest. Each directional
+  // contraction is a small dense matrix product over the tabulated 1D values
+  void eval_approx_quad_all(const NumType *, NumType *);
+
+  // Pieces of the gradient evaluation, split out so that routines evaluating
+  // several approximations at one point (the Jacobian, for instance) can
+  // evaluate the 1D basis functions once and reuse them for each contraction
+  void eval_basis_1d(const NumType *);
+  void contract_grad(const NumType *, NumType *);
+
+  // Sum-factorized contraction of coefficients against given 1D basis
+  // values, shared by the coordinate-based and quadrature-indexed
+  // approximation routines
+  NumType contract_approx(const NumType *, const NumType *, const NumType *,
+      const NumType *);
+
   // Jacobian of spatial mapping
-  void eval_jac(const NumType *, const NumType *, const NumType *, 
+  void eval_jac(const NumType *, const NumType *, const NumType *,
       const NumType *, NumType *);
-  NumType eval_det_jac(const NumType *, const NumType *, const NumType *, 
+  NumType eval_det_jac(const NumType *, const NumType *, const NumType *,
       const NumType *);
-  void eval_inv_jac(const NumType *, const NumType *, const NumType *, 
+  void eval_inv_jac(const NumType *, const NumType *, const NumType *,
       const NumType *, NumType *);
+
+  // Fused variant that computes the Jacobian, its determinant, and its
+  // inverse from a single pass through the coordinate arrays
+  void eval_jac_det_inv(const NumType *, const NumType *, const NumType *,
+      const NumType *, NumType *, NumType &, NumType *);
 };
@@ -1,5 +1,64 @@
 #include "lagrange_polynomials.h"
 
+namespace {
+  /*
+   * Fixed-vertex-count kernels behind the all-vertices evaluation routines
+   *
+   * These are identical to the runtime-count loops in eval_all and
+   * eval_der_all, except that the trip count is a template parameter. With
+   * the trip count known at compile time, the compiler fully unrolls the
+   * short loops and fuses the products and sums into multiply-add chains,
+   * which it declines to do for a runtime count
+   */
+  template <SizeType Nv, typename NumType>
+  inline void eval_all_fixed(const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *ELEMENTS_RESTRICT l) {
+    if (ic < Nv) {  // coincident
+      for (SizeType j = 0; j < Nv; j++) l[j] = j == ic ? 1.0 : 0.0;
+      return;
+    }
+
+    NumType L = 1.0;
+    for (SizeType j = 0; j < Nv; j++) {
+      l[j] = X - Z[j];
+      L *= l[j];
+    }
+
+    for (SizeType j = 0; j < Nv; j++) l[j] = 1.0/l[j];
+
+    for (SizeType j = 0; j < Nv; j++) l[j] *= L*w[j];
+  }
+
+  template <SizeType Nv, typename NumType>
+  inline void eval_der_all_fixed(const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *ELEMENTS_RESTRICT dl) {
+    if (ic < Nv) {  // coincident
+      NumType s = 0.0;
+      for (SizeType j = 0; j < Nv; j++) {
+        if (j != ic) {
+          dl[j] = (w[j]/w[ic])/(Z[ic] - Z[j]);
+          s += dl[j];
+        }
+      }
+      dl[ic] = -s;
+      return;
+    }
+
+    NumType L = 1.0;
+    for (SizeType j = 0; j < Nv; j++) {
+      dl[j] = X - Z[j];
+      L *= dl[j];
+    }
+
+    for (SizeType j = 0; j < Nv; j++) dl[j] = 1.0/dl[j];
+
+    NumType S = 0.0;
+    for (SizeType j = 0; j < Nv; j++) S += dl[j];
+
+    for (SizeType j = 0; j < Nv; j++) dl[j] = L*w[j]*dl[j]*(S - dl[j]);
+  }
+}
+
 namespace lagrange {
   /*
    * If the input coordinate is coincident with any of the input vertices,
@@ -125,7 +184,138 @@ namespace lagrange {
     return dnl;
   }
 
-  /* 
+  /*
+   * Evaluate the Lagrange polynomials associated with all vertices at a given
+   * coordinate
+   *
+   * Evaluating the polynomials together costs O(N) for all N evaluations,
+   * since the nodal polynomial is computed once and shared between the
+   * vertices, whereas evaluating them one at a time costs O(N) each
+   *
+   * Parameters
+   * ----------
+   * Nv : number of vertices
+   * ic : index of vertex coincident with X (-1 if not coincident)
+   * Z  : vertex coordinates
+   * w  : barycentric weights
+   * X  : coordinate at which to evaluate
+   *
+   * Returns
+   * -------
+   * l : evaluations of the Lagrange polynomials, one per vertex
+   */
+  template <typename NumType>
+  ELEMENTS_SIMD_DISPATCH
+  void eval_all(const SizeType Nv, const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *ELEMENTS_RESTRICT l) {
+    // Dispatch the commonly used vertex counts to fully unrolled kernels
+    switch (Nv) {
+      case 2: return eval_all_fixed<2>(ic, Z, w, X, l);
+      case 3: return eval_all_fixed<3>(ic, Z, w, X, l);
+      case 4: return eval_all_fixed<4>(ic, Z, w, X, l);
+      case 5: return eval_all_fixed<5>(ic, Z, w, X, l);
+      case 6: return eval_all_fixed<6>(ic, Z, w, X, l);
+      case 7: return eval_all_fixed<7>(ic, Z, w, X, l);
+      case 8: return eval_all_fixed<8>(ic, Z, w, X, l);
+      default: break;  // fall through to the runtime-count loops
+    }
+
+    if (ic < Nv) {  // coincident
+      for (SizeType j = 0; j < Nv; j++) l[j] = j == ic ? 1.0 : 0.0;
+      return;
+    }
+
+    // Evaluate the differences from the vertices and the nodal polynomial in
+    // one pass, staging the differences in the output array
+    NumType L = 1.0;
+    for (SizeType j = 0; j < Nv; j++) {
+      l[j] = X - Z[j];
+      L *= l[j];
+    }
+
+    // Batch the reciprocals into their own unit-stride pass: the divisions
+    // are independent, so the compiler can issue them as packed divides
+    // instead of a chain of scalar ones, and the remaining pass is pure
+    // multiply-add work
+    for (SizeType j = 0; j < Nv; j++) l[j] = 1.0/l[j];
+
+    for (SizeType j = 0; j < Nv; j++) l[j] *= L*w[j];
+  }
+
+  /*
+   * Evaluate the first derivatives of the Lagrange polynomials associated
+   * with all vertices at a given coordinate
+   *
+   * In the non-coincident case, the derivatives follow from differentiating
+   * the modified Lagrange formula: with S the logarithmic derivative of the
+   * nodal polynomial, the derivative of the polynomial associated with vertex
+   * j is its value times (S - 1/(X - Z_j)). In the coincident case, the
+   * derivatives are the entries of the standard barycentric differentiation
+   * matrix (see "Barycentric Lagrange Interpolation", Berrut and Trefethen,
+   * 2004, Sec. 9). Either way the cost is O(N) for all N derivatives
+   *
+   * Parameters
+   * ----------
+   * Nv : number of vertices
+   * ic : index of vertex coincident with X (-1 if not coincident)
+   * Z  : vertex coordinates
+   * w  : barycentric weights
+   * X  : coordinate at which to evaluate
+   *
+   * Returns
+   * -------
+   * dl : evaluations of the Lagrange polynomial derivatives, one per vertex
+   */
+  template <typename NumType>
+  ELEMENTS_SIMD_DISPATCH
+  void eval_der_all(const SizeType Nv, const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *ELEMENTS_RESTRICT dl) {
+    // Dispatch the commonly used vertex counts to fully unrolled kernels
+    switch (Nv) {
+      case 2: return eval_der_all_fixed<2>(ic, Z, w, X, dl);
+      case 3: return eval_der_all_fixed<3>(ic, Z, w, X, dl);
+      case 4: return eval_der_all_fixed<4>(ic, Z, w, X, dl);
+      case 5: return eval_der_all_fixed<5>(ic, Z, w, X, dl);
+      case 6: return eval_der_all_fixed<6>(ic, Z, w, X, dl);
+      case 7: return eval_der_all_fixed<7>(ic, Z, w, X, dl);
+      case 8: return eval_der_all_fixed<8>(ic, Z, w, X, dl);
+      default: break;  // fall through to the runtime-count loops
+    }
+
+    if (ic < Nv) {  // coincident
+      // Off-diagonal entries of the differentiation matrix, accumulating the
+      // diagonal entry from the negative sum identity
+      NumType s = 0.0;
+      for (SizeType j = 0; j < Nv; j++) {
+        if (j != ic) {
+          dl[j] = (w[j]/w[ic])/(Z[ic] - Z[j]);
+          s += dl[j];
+        }
+      }
+      dl[ic] = -s;
+      return;
+    }
+
+    // Evaluate the differences from the vertices and the nodal polynomial in
+    // one pass, staging the differences in the output array
+    NumType L = 1.0;
+    for (SizeType j = 0; j < Nv; j++) {
+      dl[j] = X - Z[j];
+      L *= dl[j];
+    }
+
+    // Batch the reciprocals into their own unit-stride pass (see the value
+    // routine), then form the logarithmic derivative of the nodal polynomial
+    // as their sum
+    for (SizeType j = 0; j < Nv; j++) dl[j] = 1.0/dl[j];
+
+    NumType S = 0.0;
+    for (SizeType j = 0; j < Nv; j++) S += dl[j];
+
+    for (SizeType j = 0; j < Nv; j++) dl[j] = L*w[j]*dl[j]*(S - dl[j]);
+  }
+
+  /*
    * Return evaluation of Lagrange interpolant, which is the sum of the
    * products of Lagrange polynomials and provided coefficients, at specified
    * coordinates
@@ -281,7 +471,17 @@ namespace lagrange {
       const SizeType i, const SizeType ic, const Complex *Z, const Complex *w, 
       const Complex X, Complex *c);
 
-  template Real eval_interp(const SizeType Nv, const SizeType i, const Real *Z, 
+  template void eval_all(const SizeType Nv, const SizeType ic, const Real *Z,
+      const Real *w, const Real X, Real *l);
+  template void eval_all(const SizeType Nv, const SizeType ic,
+      const Complex *Z, const Complex *w, const Complex X, Complex *l);
+
+  template void eval_der_all(const SizeType Nv, const SizeType ic,
+      const Real *Z, const Real *w, const Real X, Real *dl);
+  template void eval_der_all(const SizeType Nv, const SizeType ic,
+      const Complex *Z, const Complex *w, const Complex X, Complex *dl);
+
+  template Real eval_interp(const SizeType Nv, const SizeType i, const Real *Z,
       const Real *w, const Real X, const Real *c);
   template Complex eval_interp(const SizeType Nv, const SizeType i, 
       const Complex *Z, const Complex *w, const Complex X, const Complex *c);
@@ -289,7 +489,22 @@ namespace lagrange {
   template Real eval_der_interp(const SizeType Nv, const SizeType n, 
       const SizeType i, const Real *Z, const Real *w, const Real X, 
       Real *c);
-  template Complex eval_der_interp(const SizeType Nv, const SizeType n, 
-      const SizeType i, const Complex *Z, const Complex *w, const Complex X, 
+  template Complex eval_der_interp(const SizeType Nv, const SizeType n,
+      const SizeType i, const Complex *Z, const Complex *w, const Complex X,
       Complex *c);
+
+  // Instantiations backing the reduced-precision element variant
+  template SizeType find_coincident_vertex(const SizeType &N, const float *z,
+      const float &x);
+  template void compute_barycentric_weights(const SizeType &N, const float *z,
+      float *w);
+  template float eval(const SizeType Nv, const SizeType i, const SizeType ic,
+      const float *Z, const float *w, const float X);
+  template float eval_der(const SizeType Nv, const SizeType n,
+      const SizeType i, const SizeType ic, const float *Z, const float *w,
+      const float X, float *c);
+  template void eval_all(const SizeType Nv, const SizeType ic, const float *Z,
+      const float *w, const float X, float *l);
+  template void eval_der_all(const SizeType Nv, const SizeType ic,
+      const float *Z, const float *w, const float X, float *dl);
 }
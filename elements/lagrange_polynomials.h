@@ -19,10 +19,20 @@ namespace lagrange {
       const NumType *Z, const NumType *w, const NumType X);
 
   template <typename NumType>
-  NumType eval_der(const SizeType Nv, const SizeType n, 
-      const SizeType i, const SizeType ic, const NumType *Z, 
+  NumType eval_der(const SizeType Nv, const SizeType n,
+      const SizeType i, const SizeType ic, const NumType *Z,
       const NumType *w, const NumType X, NumType *c);
 
+  // All-vertices variants, which evaluate the Lagrange polynomials (or their
+  // first derivatives) associated with every vertex at a single coordinate
+  template <typename NumType>
+  void eval_all(const SizeType Nv, const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *l);
+
+  template <typename NumType>
+  void eval_der_all(const SizeType Nv, const SizeType ic, const NumType *Z,
+      const NumType *w, const NumType X, NumType *dl);
+
   // Lagrange interpolants (sums of products of bases and coefficients)
   template <typename NumType>
   NumType eval_interp(const SizeType Nv, const SizeType i, 
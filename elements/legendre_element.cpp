@@ -10,12 +10,15 @@ LegendreElement<NumType>::LegendreElement(const SizeType order) : Np(order) {
   rad[1] = N;
   rad[2] = N;
 
-  // Allocate memory for intermediate coefficients
-  C = new NumType[2*N];
+  // Allocate memory for intermediate coefficients, aligned as the
+  // evaluation routines expect of work arrays
+  C = common::allocate_aligned<NumType>(2*N);
 }
 
 template <typename NumType>
-LegendreElement<NumType>::~LegendreElement() { }
+LegendreElement<NumType>::~LegendreElement() {
+  common::deallocate_aligned(C);
+}
 
 /*
  * Return evaluation of basis function, which is the tensor product of Legendre
@@ -53,8 +56,8 @@ NumType LegendreElement<NumType>::eval_basis(const SizeType I, const NumType *X)
  * grad_phi : gradient of the basis function
  */
 template <typename NumType>
-void LegendreElement<NumType>::eval_grad_basis(const SizeType I, 
-    const  NumType *X, NumType *grad_phi) {
+void LegendreElement<NumType>::eval_grad_basis(const SizeType I,
+    const  NumType *X, NumType *ELEMENTS_RESTRICT grad_phi) {
   // Decompose index of 3D tensor product basis function into indices of
   // Legendre polynomials
   common::base_10_to_mixed_radix(Nd, rad, I, ijk);
@@ -129,8 +132,8 @@ NumType LegendreElement<NumType>::eval_approx(const NumType *c,
  * grad_f : gradient of the approximation
  */
 template <typename NumType>
-void LegendreElement<NumType>::eval_grad_approx(const NumType *c, 
-    const NumType *X, NumType *grad_f) {
+void LegendreElement<NumType>::eval_grad_approx(const NumType *c,
+    const NumType *X, NumType *ELEMENTS_RESTRICT grad_f) {
   SizeType q = 1;  // order of derivative
   for (int l = 0; l < Nd; l++) {
     for (int k = 0; k < N; k++) {
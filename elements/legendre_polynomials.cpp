@@ -19,6 +19,32 @@ namespace legendre {
         - (double(n) - 1.0)*eval(n - 2, X));
   };
 
+  /*
+   * Evaluate all Legendre polynomials of order 0 through N - 1 at a given
+   * coordinate in a single upward pass of the three-term recurrence. This
+   * costs O(N) work total, where evaluating each order through eval would
+   * restart the recurrence from order 0 every time
+   *
+   * Parameters
+   * ----------
+   * N : number of polynomials (maximum order plus one)
+   * X : coordinate in reference space [-1, 1]
+   * P : output array of N polynomial evaluations
+   */
+  template <typename NumType>
+  void eval_all(const SizeType N, const NumType X,
+      NumType *ELEMENTS_RESTRICT P) {
+    if (N == 0) return;
+    P[0] = 1.0;
+    if (N == 1) return;
+    P[1] = X;
+
+    for (SizeType n = 2; n < N; n++) {
+      P[n] = (1.0/double(n))*((2.0*double(n) - 1.0)*X*P[n - 1]
+          - (double(n) - 1.0)*P[n - 2]);
+    }
+  };
+
   /*
    * Return evaluation of Legendre polynomial of specified order at given
    * coordinate
@@ -34,6 +60,57 @@ namespace legendre {
     return jacobi::eval_der(n, k, 0.0, 0.0, X);
   };
 
+  /*
+   * Evaluate the k-th derivatives of all Legendre polynomials of order 0
+   * through N - 1 at a given coordinate. The k-th derivative of the order-n
+   * Legendre polynomial is a scaled Jacobi polynomial of degree n - k with
+   * parameters (k, k), so all N derivatives come from one upward pass of
+   * that recurrence with a running scale factor, O(N) work total
+   *
+   * Parameters
+   * ----------
+   * N  : number of polynomials (maximum order plus one)
+   * k  : order of derivative
+   * X  : coordinate in reference space [-1, 1]
+   * dP : output array of N derivative evaluations
+   */
+  template <typename NumType>
+  void eval_der_all(const SizeType N, const SizeType k, const NumType X,
+      NumType *ELEMENTS_RESTRICT dP) {
+    if (k == 0) {
+      eval_all(N, X, dP);
+      return;
+    }
+
+    // Derivatives of order k annihilate the polynomials below order k
+    for (SizeType n = 0; n < N && n < k; n++) {
+      dP[n] = 0.0;
+    }
+    if (N <= k) return;
+
+    // Scale factor 0.5^k (n + 1)...(n + k) at n = k, advanced by a ratio
+    // as n increases
+    Real s = 1.0;
+    for (SizeType j = 1; j <= k; j++) {
+      s *= 0.5*double(k + j);
+    }
+
+    const Real alpha = double(k);
+    NumType pm1 = 0.0;
+    NumType p = 1.0;
+
+    for (SizeType n = k; n < N; n++) {
+      dP[n] = s*p;
+      s *= double(n + k + 1)/double(n + 1);
+
+      const int m = int(n - k) + 1;  // next shifted Jacobi degree
+      NumType pk = (jacobi::a(alpha, alpha, m)*X
+          + jacobi::b(alpha, alpha, m))*p - jacobi::c(alpha, alpha, m)*pm1;
+      pm1 = p;
+      p = pk;
+    }
+  };
+
   /*
    * Return evaluation of Legendre polynomial approximation, which is the sum
    * of the products of Legendre polynomials and provided coefficients, at a
@@ -47,9 +124,24 @@ namespace legendre {
    */
   template <typename NumType>
   NumType eval_approx(const SizeType N, const NumType *c, const NumType X) {
-    NumType sum = 0.0;
-    for (SizeType j = 0; j < N; j++) {
-      sum += c[j]*eval(j, X);
+    // Carry the three-term recurrence through the sum, so that the full
+    // approximation costs one O(N) sweep instead of restarting the
+    // recurrence for every term
+    if (N == 0) return 0.0;
+
+    NumType Pnm2 = 1.0;
+    NumType sum = c[0]*Pnm2;
+    if (N == 1) return sum;
+
+    NumType Pnm1 = X;
+    sum += c[1]*Pnm1;
+
+    for (SizeType n = 2; n < N; n++) {
+      NumType Pn = (1.0/double(n))*((2.0*double(n) - 1.0)*X*Pnm1
+          - (double(n) - 1.0)*Pnm2);
+      sum += c[n]*Pn;
+      Pnm2 = Pnm1;
+      Pnm1 = Pn;
     }
 
     return sum;
@@ -67,11 +159,32 @@ namespace legendre {
    * X : coordinate in reference space [-1, 1]
    */
   template <typename NumType>
-  NumType eval_der_approx(const SizeType N, const SizeType k, const NumType *c, 
+  NumType eval_der_approx(const SizeType N, const SizeType k, const NumType *c,
       const NumType X) {
+    // Carry the shifted Jacobi recurrence through the sum, as in
+    // eval_der_all, so the full derivative sum is one O(N) sweep
+    if (k == 0) return eval_approx(N, c, X);
+    if (N <= k) return 0.0;
+
+    Real s = 1.0;
+    for (SizeType j = 1; j <= k; j++) {
+      s *= 0.5*double(k + j);
+    }
+
+    const Real alpha = double(k);
+    NumType pm1 = 0.0;
+    NumType p = 1.0;
     NumType sum = 0.0;
-    for (SizeType j = 0; j < N; j++) {
-      sum += c[j]*eval_der(j, k, X);
+
+    for (SizeType n = k; n < N; n++) {
+      sum += c[n]*s*p;
+      s *= double(n + k + 1)/double(n + 1);
+
+      const int m = int(n - k) + 1;  // next shifted Jacobi degree
+      NumType pk = (jacobi::a(alpha, alpha, m)*X
+          + jacobi::b(alpha, alpha, m))*p - jacobi::c(alpha, alpha, m)*pm1;
+      pm1 = p;
+      p = pk;
     }
 
     return sum;
@@ -81,9 +194,17 @@ namespace legendre {
   template Real eval(const int n, const Real X);
   template Complex eval(const int n, const Complex X);
 
+  template void eval_all(const SizeType N, const Real X, Real *P);
+  template void eval_all(const SizeType N, const Complex X, Complex *P);
+
   template Real eval_der(const int n, const int k, const Real X);
   template Complex eval_der(const int n, const int k, const Complex X);
 
+  template void eval_der_all(const SizeType N, const SizeType k, const Real X,
+      Real *dP);
+  template void eval_der_all(const SizeType N, const SizeType k,
+      const Complex X, Complex *dP);
+
   template Real eval_approx(const SizeType N, const Real *c, const Real X);
   template Complex eval_approx(const SizeType N, const Complex *c, 
       const Complex X);
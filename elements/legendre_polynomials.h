@@ -7,9 +7,20 @@ namespace legendre {
   template <typename NumType>
   NumType eval(const int n, const NumType X);
 
+  // All Legendre polynomials of order 0 through N - 1 at one coordinate, in
+  // one pass of the three-term recurrence
+  template <typename NumType>
+  void eval_all(const SizeType N, const NumType X, NumType *P);
+
   template <typename NumType>
   NumType eval_der(const int n, const int k, const NumType X);
 
+  // k-th derivatives of all Legendre polynomials of order 0 through N - 1 at
+  // one coordinate, in one pass of the shifted Jacobi recurrence
+  template <typename NumType>
+  void eval_der_all(const SizeType N, const SizeType k, const NumType X,
+      NumType *dP);
+
   // Legendre approximations (sums of products of bases and coefficients)
   template <typename NumType>
   NumType eval_approx(const SizeType N, const NumType *c, const NumType X);
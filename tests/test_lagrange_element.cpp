@@ -23,6 +23,7 @@ struct TestParams {
   LagrangeElement<NumType> *elem;
 
   NumType *c;
+  NumType *Z;
 
   NumType X[3];
   NumType Xv[3];
@@ -32,17 +33,19 @@ struct TestParams {
     SizeType Np = order;
     SizeType N = order + 1;
 
-    // Generate a set of points between -1 and 1
+    // Generate a set of points between -1 and 1. The element keeps a
+    // reference to these points, so they are a member and outlive it
     NumType Zl = -1.0;
     NumType Zr = 1.0;
-    NumType *Z = new NumType[N];
+    Z = common::allocate_aligned<NumType>(N);
     equispaced_points(N, Zl, Zr, Z);
 
     // Create Lagrange element
     elem = new LagrangeElement<NumType>(Np, Z);
 
-    // Generate random array of coefficients between 0 and 1
-    c = new NumType[elem->Ne];
+    // Generate random array of coefficients between 0 and 1, in an
+    // aligned allocation as the evaluation routines expect of work arrays
+    c = common::allocate_aligned<NumType>(elem->Ne);
     for (SizeType i = 0; i < elem->Ne; i++) {
       c[i] = Real(rand())/RAND_MAX;
     }
@@ -62,7 +65,11 @@ struct TestParams {
     Xv[2] = Z[K];
   };
 
-  ~TestParams() { delete elem; }
+  ~TestParams() {
+    delete elem;
+    common::deallocate_aligned(c);
+    common::deallocate_aligned(Z);
+  }
 };
 
 /*
@@ -228,29 +235,24 @@ bool test3(TestParams<Complex> &p) {
   bool pass = false;
 
   Complex Xc[3];
-  Complex phi;
-
-  std::copy(p.X, p.X+3, Xc);
-  Xc[0] += Complex(0, h);
-  phi = p.elem->eval_basis(0, Xc);
-  Real d0phi = common::imag(phi)/h;
-
-  std::copy(p.X, p.X+3, Xc);
-  Xc[1] += Complex(0, h);
-  phi = p.elem->eval_basis(0, Xc);
-  Real d1phi = common::imag(phi)/h;
+  Real dphi_cs[3];
 
+  // Copy the coordinate once; each direction perturbs its component in
+  // place and restores it afterward
   std::copy(p.X, p.X+3, Xc);
-  Xc[2] += Complex(0, h);
-  phi = p.elem->eval_basis(0, Xc);
-  Real d2phi = common::imag(phi)/h;
+  for (SizeType d = 0; d < 3; d++) {
+    Xc[d] += Complex(0, h);
+    Complex phi = p.elem->eval_basis(0, Xc);
+    dphi_cs[d] = common::imag(phi)/h;
+    Xc[d] = p.X[d];
+  }
 
   Complex grad_phi[3];
   p.elem->eval_grad_basis(0, p.X, grad_phi);
 
-  Real rel_error0 = common::abs((grad_phi[0] - d0phi)/d0phi);
-  Real rel_error1 = common::abs((grad_phi[1] - d1phi)/d1phi);
-  Real rel_error2 = common::abs((grad_phi[2] - d2phi)/d2phi);
+  Real rel_error0 = common::abs((grad_phi[0] - dphi_cs[0])/dphi_cs[0]);
+  Real rel_error1 = common::abs((grad_phi[1] - dphi_cs[1])/dphi_cs[1]);
+  Real rel_error2 = common::abs((grad_phi[2] - dphi_cs[2])/dphi_cs[2]);
 
   if (rel_error0 < tol && rel_error1 < tol && rel_error2 < tol) {
     pass = true;
@@ -272,25 +274,37 @@ int main() {
             << "---------------------" 
             << std::endl;
 
-  // Initialize random seed
-  srand(time(NULL));
+  // Initialize random seed. The seed is fixed so that runs are
+  // reproducible and profile-guided builds see a stable profile
+  srand(3271993);
+
+  // Optional repetition count for profiling and benchmarking runs (see
+  // the ELEMENTS_ENABLE_PGO build option); a single pass is the default
+  int reps = 1;
+  if (const char *reps_env = std::getenv("ELEMENTS_TEST_REPS")) {
+    reps = std::atoi(reps_env);
+    if (reps < 1) reps = 1;
+  }
 
   // Generate real-valued test parameters
   TestParams<Real> rp(8);
 
-  // Run test 1
-  bool pass1 = test1(rp);
-  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
-
-  // Run test 2
-  bool pass2 = test2(rp);
-  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
-
   // Generate complex-valued test parameters
   TestParams<Complex> ip(8);
 
-  // Run test 3
-  bool pass3 = test3(ip);
+  // Run the tests; every repetition must pass
+  bool pass1 = true;
+  bool pass2 = true;
+  bool pass3 = true;
+
+  for (int rep = 0; rep < reps; rep++) {
+    pass1 = test1(rp) && pass1;
+    pass2 = test2(rp) && pass2;
+    pass3 = test3(ip) && pass3;
+  }
+
+  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
+  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
   std::cout << "TEST 3 " << (pass3 ? "PASSED" : "FAILED") << std::endl;
 
   std::cout << std::endl;
@@ -38,8 +38,9 @@ struct TestParams {
     Np = order;
     Nv = Np + 1;  // number of vertices
 
-    // Generate random array of coefficients between 0 and 1
-    c = new NumType[Nv];
+    // Generate random array of coefficients between 0 and 1, in an
+    // aligned allocation as the evaluation routines expect of work arrays
+    c = common::allocate_aligned<NumType>(Nv);
     for (SizeType i = 0; i < Nv; i++) {
       c[i] = Real(rand())/RAND_MAX;
     }
@@ -47,11 +48,11 @@ struct TestParams {
     // Generate a set of points between -1 and 1
     Zl = -1.0;
     Zr = 1.0;
-    Z = new NumType[Nv];
+    Z = common::allocate_aligned<NumType>(Nv);
     equispaced_points(Nv, Zl, Zr, Z);
 
     // Compute barycentric weights
-    w = new NumType[Nv];
+    w = common::allocate_aligned<NumType>(Nv);
     lagrange::compute_barycentric_weights(Nv, Z, w);
 
     // Select a random coordinate between -1 and 1
@@ -61,11 +62,14 @@ struct TestParams {
     I = std::round((Nv - 1)*Real(rand())/Real(RAND_MAX));
 
     // Allocate workspace
-    C = new NumType[Nv];
+    C = common::allocate_aligned<NumType>(Nv);
   };
 
   ~TestParams() {
-    delete [] c, Z, w, C;
+    common::deallocate_aligned(c);
+    common::deallocate_aligned(Z);
+    common::deallocate_aligned(w);
+    common::deallocate_aligned(C);
   }
 };
 
@@ -266,25 +270,37 @@ int main() {
             << "-------------------------" 
             << std::endl;
 
-  // Initialize random seed
-  srand(time(NULL));
+  // Initialize random seed. The seed is fixed so that runs are
+  // reproducible and profile-guided builds see a stable profile
+  srand(3271993);
+
+  // Optional repetition count for profiling and benchmarking runs (see
+  // the ELEMENTS_ENABLE_PGO build option); a single pass is the default
+  int reps = 1;
+  if (const char *reps_env = std::getenv("ELEMENTS_TEST_REPS")) {
+    reps = std::atoi(reps_env);
+    if (reps < 1) reps = 1;
+  }
 
   // Generate real-valued test parameters
   TestParams<Real> rp(8);
 
-  // Run test 1
-  bool pass1 = test1(rp);
-  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
-
-  // Run test 2
-  bool pass2 = test2(rp);
-  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
-
   // Generate complex-valued test parameters
   TestParams<Complex> ip(8);
 
-  // Run test 3
-  bool pass3 = test3(ip);
+  // Run the tests; every repetition must pass
+  bool pass1 = true;
+  bool pass2 = true;
+  bool pass3 = true;
+
+  for (int rep = 0; rep < reps; rep++) {
+    pass1 = test1(rp) && pass1;
+    pass2 = test2(rp) && pass2;
+    pass3 = test3(ip) && pass3;
+  }
+
+  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
+  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
   std::cout << "TEST 3 " << (pass3 ? "PASSED" : "FAILED") << std::endl;
 
   std::cout << std::endl;
@@ -34,8 +34,9 @@ struct TestParams {
     // Create Legendre element
     elem = new LegendreElement<NumType>(Np);
 
-    // Generate random array of coefficients between 0 and 1
-    c = new NumType[elem->Ne];
+    // Generate random array of coefficients between 0 and 1, in an
+    // aligned allocation as the evaluation routines expect of work arrays
+    c = common::allocate_aligned<NumType>(elem->Ne);
     for (SizeType i = 0; i < elem->Ne; i++) {
       //c[i] = Real(rand())/RAND_MAX;
       c[i] = i == 182 ? 1.0 : 0.0;
@@ -49,7 +50,10 @@ struct TestParams {
     X[2] = Zl + (Zr - Zl)*(Real(rand())/RAND_MAX);
   };
 
-  ~TestParams() { delete elem; }
+  ~TestParams() {
+    delete elem;
+    common::deallocate_aligned(c);
+  }
 };
 
 /*
@@ -198,25 +202,37 @@ int main() {
             << "---------------------" 
             << std::endl;
 
-  // Initialize random seed
-  srand(time(NULL));
+  // Initialize random seed. The seed is fixed so that runs are
+  // reproducible and profile-guided builds see a stable profile
+  srand(3271993);
+
+  // Optional repetition count for profiling and benchmarking runs (see
+  // the ELEMENTS_ENABLE_PGO build option); a single pass is the default
+  int reps = 1;
+  if (const char *reps_env = std::getenv("ELEMENTS_TEST_REPS")) {
+    reps = std::atoi(reps_env);
+    if (reps < 1) reps = 1;
+  }
 
   // Generate real-valued test parameters
   TestParams<Real> rp(8);
 
-  // Run test 1
-  bool pass1 = test1(rp);
-  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
-
-  // Run test 2
-  bool pass2 = test2(rp);
-  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
-
   // Generate complex-valued test parameters
   TestParams<Complex> ip(8);
 
-  // Run test 3
-  bool pass3 = test3(ip);
+  // Run the tests; every repetition must pass
+  bool pass1 = true;
+  bool pass2 = true;
+  bool pass3 = true;
+
+  for (int rep = 0; rep < reps; rep++) {
+    pass1 = test1(rp) && pass1;
+    pass2 = test2(rp) && pass2;
+    pass3 = test3(ip) && pass3;
+  }
+
+  std::cout << "TEST 1 " << (pass1 ? "PASSED" : "FAILED") << std::endl;
+  std::cout << "TEST 2 " << (pass2 ? "PASSED" : "FAILED") << std::endl;
   std::cout << "TEST 3 " << (pass3 ? "PASSED" : "FAILED") << std::endl;
 
   std::cout << std::endl;